@@ -58,15 +58,40 @@
 #define HPL_NO_COPY_L
 #endif
  
+#ifndef HPL_NO_PTHREADS     /* Use POSIX threads within each process */
+#define HPL_USE_PTHREADS
+#endif
+ 
 #ifndef HPL_DETAILED_TIMING         /* Do not enable detailed timings */
 #define HPL_NO_DETAILED_TIMING
 #endif
  
 #ifndef HPL_CALL_VSIPL          /* Call the Fortran 77 BLAS interface */
 #ifndef HPL_CALL_CBLAS                       /* there can be only one */
+#ifndef HPL_CALL_HPLBLAS
+#ifndef HPL_CALL_DLBLAS
 #define HPL_CALL_FBLAS
 #endif
 #endif
+#endif
+#endif
+
+#ifdef HPL_CALL_VSIPL        /* Use the BLAS kernels built into HPL */
+#define HPL_USE_BUILTIN_BLAS
+#endif
+#ifdef HPL_CALL_HPLBLAS
+#define HPL_USE_BUILTIN_BLAS
+#endif
+#ifdef HPL_CALL_DLBLAS  /* BLAS selected at run time, built-in fallback */
+#define HPL_USE_BUILTIN_BLAS
+#ifndef HPL_BLAS_STATS          /* and per-routine statistics are kept */
+#define HPL_BLAS_STATS
+#endif
+#endif
+
+#ifndef HPL_BLAS_STATS      /* Do not collect BLAS call statistics */
+#define HPL_NO_BLAS_STATS
+#endif
 /*
  * ---------------------------------------------------------------------
  * Include files
@@ -76,6 +101,7 @@
 #include "hpl_blas.h"
 #include "hpl_auxil.h"
 #include "hpl_gesv.h"
+#include "hpl_thread.h"
 
 #include "hpl_pmisc.h"
 #include "hpl_pauxil.h"
@@ -156,9 +156,11 @@ STDC_ARGS(
    const int ) );
 /*
  * ---------------------------------------------------------------------
- * HPL C BLAS macro definition
+ * HPL C BLAS macro definition,  unless the calls  go  through the HPL
+ * wrappers to be instrumented
  * ---------------------------------------------------------------------
  */
+#ifndef HPL_BLAS_STATS
 #define    HPL_dswap           cblas_dswap
 #define    HPL_dcopy           cblas_dcopy
 #define    HPL_daxpy           cblas_daxpy
@@ -171,6 +173,85 @@ STDC_ARGS(
 
 #define    HPL_dgemm           cblas_dgemm
 #define    HPL_dtrsm           cblas_dtrsm
+#endif
+
+#endif
+
+#ifdef HPL_CALL_DLBLAS
+/*
+ * ---------------------------------------------------------------------
+ * The C interface of the BLAS is loaded at run time ...
+ * ---------------------------------------------------------------------
+ * #define macro constants
+ * ---------------------------------------------------------------------
+ */
+#define    HPL_BLAS_NAMLEN     256     /* max. length of the backend name */
+/*
+ * ---------------------------------------------------------------------
+ * typedef definitions
+ * ---------------------------------------------------------------------
+ *
+ * The  cblas_*  entry points  are resolved  with dlsym.  A NULL pointer
+ * selects the corresponding kernel built into HPL.  The HPL enumeration
+ * values are those of the CBLAS standard and are passed as is.
+ */
+typedef struct HPL_S_blas
+{
+   void                * handle;         /* shared library (dlopen) */
+   char                name[HPL_BLAS_NAMLEN];     /* backend in use */
+   void                (*dcopy)
+                       ( const int, const double *, const int, double *,
+                         const int );
+   void                (*daxpy)
+                       ( const int, const double, const double *,
+                         const int, double *, const int );
+   void                (*dscal)
+                       ( const int, const double, double *, const int );
+   size_t              (*idamax)
+                       ( const int, const double *, const int );
+   void                (*dgemv)
+                       ( const enum HPL_ORDER, const enum HPL_TRANS,
+                         const int, const int, const double,
+                         const double *, const int, const double *,
+                         const int, const double, double *, const int );
+   void                (*dtrsv)
+                       ( const enum HPL_ORDER, const enum HPL_UPLO,
+                         const enum HPL_TRANS, const enum HPL_DIAG,
+                         const int, const double *, const int, double *,
+                         const int );
+   void                (*dger)
+                       ( const enum HPL_ORDER, const int, const int,
+                         const double, const double *, const int,
+                         const double *, const int, double *,
+                         const int );
+   void                (*dgemm)
+                       ( const enum HPL_ORDER, const enum HPL_TRANS,
+                         const enum HPL_TRANS, const int, const int,
+                         const int, const double, const double *,
+                         const int, const double *, const int,
+                         const double, double *, const int );
+   void                (*dtrsm)
+                       ( const enum HPL_ORDER, const enum HPL_SIDE,
+                         const enum HPL_UPLO, const enum HPL_TRANS,
+                         const enum HPL_DIAG, const int, const int,
+                         const double, const double *, const int,
+                         double *, const int );
+} HPL_T_blas;
+
+extern HPL_T_blas      HPL_blas;
+/*
+ * ---------------------------------------------------------------------
+ * Function prototypes
+ * ---------------------------------------------------------------------
+ */
+int                              HPL_blas_init
+STDC_ARGS( (
+   const char *
+) );
+void                             HPL_blas_exit
+STDC_ARGS( (
+   void
+) );
 
 #endif
 
@@ -472,13 +553,67 @@ STDC_ARGS(
    F77_INT_DECL,    F77_INT_DECL,    F77_SIN_DECL,    F77_MIN_DECL,
    F77_INT_DECL,    F77_MINOUT_DECL, F77_INT_DECL     F77_4_CHAR ) );
 
+#endif
+/*
+ * ---------------------------------------------------------------------
+ * BLAS call statistics ...
+ * ---------------------------------------------------------------------
+ * #define macro constants
+ * ---------------------------------------------------------------------
+ */
+#define    HPL_BLAS_DCOPY      0
+#define    HPL_BLAS_DAXPY      1
+#define    HPL_BLAS_DSCAL      2
+#define    HPL_BLAS_IDAMAX     3
+#define    HPL_BLAS_DGEMV      4
+#define    HPL_BLAS_DTRSV      5
+#define    HPL_BLAS_DGER       6
+#define    HPL_BLAS_DGEMM      7
+#define    HPL_BLAS_DTRSM      8
+#define    HPL_BLAS_NFUN       9     /* # of instrumented BLAS routines */
+
+#define    HPL_BLAS_NBIN       10         /* # of shape histogram bins */
+/*
+ * ---------------------------------------------------------------------
+ * typedef definitions
+ * ---------------------------------------------------------------------
+ *
+ * Every call is accounted for in the bin  b  of its routine,  where b
+ * is the base-2 logarithm  of  the smallest dimension of the operands
+ * (the smallest of M, N and K for dgemm), at most NBIN-1. The skinny
+ * updates of the trailing matrix fall into the bin of  the  panel
+ * width. The times of the threads of a process add up.
+ */
+typedef struct HPL_S_blst
+{
+   double              ncall[HPL_BLAS_NFUN][HPL_BLAS_NBIN]; /* # calls */
+   double              flops[HPL_BLAS_NFUN][HPL_BLAS_NBIN]; /* # flops */
+   double              time [HPL_BLAS_NFUN][HPL_BLAS_NBIN]; /* wall t. */
+} HPL_T_blst;
+
+#ifdef HPL_BLAS_STATS
+
+extern HPL_T_blst      HPL_blst;
+
+void                             HPL_blas_stat
+STDC_ARGS( (
+   const int,
+   const int,
+   const double,
+   const double
+) );
+void                             HPL_blas_reset
+STDC_ARGS( (
+   void
+) );
+
 #endif
 /*
  * ---------------------------------------------------------------------
  * HPL BLAS Function prototypes
  * ---------------------------------------------------------------------
  */
-#ifndef HPL_CALL_CBLAS
+#if ( !defined( HPL_CALL_CBLAS ) || defined( HPL_BLAS_STATS ) )
 
 int                              HPL_idamax
 STDC_ARGS( (
@@ -592,6 +727,41 @@ STDC_ARGS( (
 ) );
 
 #endif
+/*
+ * Pre-packing of the left operand of  HPL_dgemm,  so that a matrix used
+ * in several products is packed once.  Available with every BLAS, but a
+ * size of zero is returned when packing is not supported, in which case
+ * HPL_dgemmpk must be called with a NULL packed operand.
+ */
+size_t                           HPL_dgepack_size
+STDC_ARGS( (
+   const int,
+   const int
+) );
+void                             HPL_dgepack
+STDC_ARGS( (
+   const int,
+   const int,
+   const double *,
+   const int,
+   double *
+) );
+void                             HPL_dgemmpk
+STDC_ARGS( (
+   const enum HPL_TRANS,
+   const int,
+   const int,
+   const int,
+   const double,
+   const double *,
+   const double *,
+   const int,
+   const double *,
+   const int,
+   const double,
+   double *,
+   const int
+) );
 
 #endif
 /*
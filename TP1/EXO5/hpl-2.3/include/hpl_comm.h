@@ -130,6 +130,14 @@ void                             HPL_copyL
 STDC_ARGS( (
    HPL_T_panel *
 ) );
+void                             HPL_bcomp
+STDC_ARGS( (
+   HPL_T_panel *
+) );
+void                             HPL_bexpand
+STDC_ARGS( (
+   HPL_T_panel *
+) );
  
 int HPL_binit_1ring STDC_ARGS( ( HPL_T_panel *        ) );
 int HPL_bcast_1ring STDC_ARGS( ( HPL_T_panel *, int * ) );
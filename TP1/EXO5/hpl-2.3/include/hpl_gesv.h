@@ -62,7 +62,8 @@ typedef enum
 {
    HPL_LEFT_LOOKING  = 301,           /* Left looking lu fact variant */
    HPL_CROUT         = 302,                  /* Crout lu fact variant */
-   HPL_RIGHT_LOOKING = 303           /* Right looking lu fact variant */
+   HPL_RIGHT_LOOKING = 303,          /* Right looking lu fact variant */
+   HPL_RECURSIVE     = 304         /* Binary recursive lu fact variant */
 } HPL_T_FACT;
 /*
  * ---------------------------------------------------------------------
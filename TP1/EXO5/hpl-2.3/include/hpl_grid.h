@@ -57,6 +57,12 @@
  * ---------------------------------------------------------------------
  */
 typedef enum { HPL_INT       = 100, HPL_DOUBLE       = 101 } HPL_T_TYPE;
+
+typedef enum
+{
+   HPL_COLL_TREE     = 301,             /* binomial trees of Send/Recv */
+   HPL_COLL_MPI      = 302                    /* native MPI collectives */
+} HPL_T_COLL;
  
 typedef enum
 {
@@ -84,6 +90,13 @@ typedef struct HPL_S_grid
    int             col_hdim;     /* col_ip2 procs hypercube dimension */
    int             col_ip2m1;      /* largest power of two <= npcol-1 */
    int             col_mask;        /* col_ip2m1 procs hypercube mask */
+   int             wcyc;    /* # of blocks of a weighted column cycle */
+   int             ncyc;     /* wcyc when the weights apply, 0 if not */
+   int             * cwgt; /* # of blocks per cycle of every proc col */
+   int             * coff;        /* offset of every proc col in cblk */
+   int             * cmap;  /* proc col owning every block of a cycle */
+   int             * cloc;       /* local # of every block of a cycle */
+   int             * cblk;  /* blocks of the cycle owned by every col */
 } HPL_T_grid;
 
 /*
@@ -93,6 +106,8 @@ typedef struct HPL_S_grid
  */
 typedef void (*HPL_T_OP)
 (  const int,       const void *,    void *,          const HPL_T_TYPE );
+
+extern HPL_T_COLL                HPL_coll;
 /*
  * ---------------------------------------------------------------------
  * #define macros definitions
@@ -100,6 +115,13 @@ typedef void (*HPL_T_OP)
  */
 #define    HPL_2_MPI_TYPE( typ ) \
                            ( ( typ == HPL_INT ? MPI_INT : MPI_DOUBLE ) )
+/*
+ * The built-in MPI operation computing the same as an HPL combine func-
+ * tion, or MPI_OP_NULL if there is none
+ */
+#define    HPL_2_MPI_OP( op ) \
+           ( (op) == HPL_max ? MPI_MAX : ( (op) == HPL_min ? MPI_MIN : \
+           ( (op) == HPL_sum ? MPI_SUM : MPI_OP_NULL ) ) )
 /*
  * The following macros perform common modulo operations;  All functions
  * except MPosMod assume arguments are < d (i.e., arguments are themsel-
@@ -139,6 +161,12 @@ STDC_ARGS( (
    HPL_T_grid *
 ) );
 
+int                              HPL_grid_wght
+STDC_ARGS( (
+   HPL_T_grid *,
+   const int *
+) );
+
 int                              HPL_grid_info
 STDC_ARGS( (
    const HPL_T_grid *,
@@ -65,11 +65,14 @@ typedef struct HPL_S_panel
    double              * A;              /* ptr to trailing part of A */
    double              * WORK;                          /* work space */
    double              * L2;                              /* ptr to L */
+   double              * L2P;     /* packed copy of L2 for the update */
+   double              * L2S;  /* L2 in single precision + L1 to bcast */
    double              * L1;       /* ptr to jb x jb upper block of A */
    double              * DPIV;    /* ptr to replicated jb pivot array */
    double              * DINFO;      /* ptr to replicated scalar info */
    double              * U;                               /* ptr to U */
    int                 * IWORK;     /* integer workspace for swapping */
+   int                 * IPTAB;  /* owner/local index table of pivots */
    void                * * * buffers[2];   /* buffers for panel bcast */
    int                 counts [2];          /* counts for panel bcast */
    MPI_Datatype        dtypes [2];      /* data types for panel bcast */
@@ -140,6 +143,10 @@ int                              HPL_pdpanel_free
 STDC_ARGS( (
    HPL_T_panel *
 ) );
+void                             HPL_pdpanel_pack
+STDC_ARGS( (
+   HPL_T_panel *
+) );
 
 #endif
 /*
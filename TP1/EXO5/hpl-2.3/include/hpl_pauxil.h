@@ -56,11 +56,65 @@
 
 #include "hpl_pmisc.h"
 #include "hpl_grid.h"
+/*
+ * ---------------------------------------------------------------------
+ * Data Structures
+ * ---------------------------------------------------------------------
+ */
+typedef struct HPL_S_ixmap
+{
+   int                 * g2p;  /* process owning every global index */
+   int                 * g2l;  /* local index of every global index */
+   int                 * cnt;   /* # of indexes of proc before each */
+   int                 * l2g; /* global index of local ones of proc */
+   int                 n;         /* # of global indexes in the map */
+   int                 nb;          /* distribution blocking factor */
+   int                 proc;    /* process coordinate of the tables */
+   int                 nprocs;  /* # of processes in this dimension */
+   int                 np;         /* # of indexes residing in proc */
+} HPL_T_ixmap;
+
+extern HPL_T_ixmap               HPL_ixmap[2];
+/*
+ * Progress of a producer of columns: the number of columns available
+ */
+typedef void (*HPL_T_PROG_FUN)
+(  void *,          const int );
 /*
  * ---------------------------------------------------------------------
  * #define macros definitions
  * ---------------------------------------------------------------------
  */
+/*
+ * Mixmap  returns the cached map of  HPL_ixmap  describing the indexes
+ * 0:n_-1 distributed with the parameters inb_, nb_, src_ and nprocs_,
+ * or NULL when none does.  When proc_ is not negative,  the map tables
+ * must also be those of the process proc_.  Mixmap0 does the same for
+ * a map of any length,  as needed by the local to global conversions.
+ */
+#define    Mixmap2( m_, nb_, proc_, nprocs_ )                          \
+           ( ( (m_).nb == (nb_) ) && ( (m_).nprocs == (nprocs_) ) &&   \
+             ( ( (proc_) < 0 ) || ( (m_).proc == (proc_) ) ) )
+
+#define    Mixmap1( m_, n_, nb_, proc_, nprocs_ )                      \
+           ( Mixmap2( m_, nb_, proc_, nprocs_ ) &&                     \
+             ( (unsigned int)(n_) <= (unsigned int)((m_).n) ) )
+
+#define    Mixmap( n_, inb_, nb_, proc_, src_, nprocs_ )               \
+           ( ( ( (inb_) != (nb_) ) || ( (src_) != 0 ) ) ?              \
+             (HPL_T_ixmap *)(NULL) :                                   \
+             ( Mixmap1( HPL_ixmap[0], n_, nb_, proc_, nprocs_ ) ?      \
+               HPL_ixmap :                                             \
+               ( Mixmap1( HPL_ixmap[1], n_, nb_, proc_, nprocs_ ) ?    \
+                 HPL_ixmap + 1 : (HPL_T_ixmap *)(NULL) ) ) )
+
+#define    Mixmap0( inb_, nb_, proc_, src_, nprocs_ )                  \
+           ( ( ( (inb_) != (nb_) ) || ( (src_) != 0 ) ) ?              \
+             (HPL_T_ixmap *)(NULL) :                                   \
+             ( Mixmap2( HPL_ixmap[0], nb_, proc_, nprocs_ ) ?          \
+               HPL_ixmap :                                             \
+               ( Mixmap2( HPL_ixmap[1], nb_, proc_, nprocs_ ) ?        \
+                 HPL_ixmap + 1 : (HPL_T_ixmap *)(NULL) ) ) )
 /*
  * Mindxg2p  returns the process coodinate owning the entry globally in-
  * dexed by ig_.
@@ -111,11 +165,18 @@
            }
 /*
  * Mindxl2g computes the global index ig_ corresponding to the local
- * index il_ in process proc_.
+ * index il_ in process proc_, or reads it from a map of HPL_ixmap.
  */
 #define    Mindxl2g( ig_, il_, inb_, nb_, proc_, src_, nprocs_ )       \
            {                                                           \
-              if( ( (src_) >= 0 ) && ( (nprocs_) > 1 ) )               \
+              HPL_T_ixmap * map__;                                     \
+              if( ( ( map__ = Mixmap0( inb_, nb_, proc_, src_,         \
+                                       nprocs_ ) ) != NULL ) &&        \
+                  ( (unsigned int)(il_) < (unsigned int)(map__->np) ) )\
+              {                                                        \
+                 ig_ = map__->l2g[(il_)];                              \
+              }                                                        \
+              else if( ( (src_) >= 0 ) && ( (nprocs_) > 1 ) )          \
               {                                                        \
                  if( (proc_) == (src_) )                               \
                  {                                                     \
@@ -146,11 +207,19 @@
  * of coordinate  proc_  corresponding to the interval of global indexes
  * i_:i_+n_-1  assuming  that the global index 0 resides in  the process
  * src_,  and that the indexes are distributed from src_ using the para-
- * meters inb_, nb_ and nprocs_.
+ * meters inb_, nb_ and nprocs_.  The difference of two entries of a map
+ * of HPL_ixmap is used instead when one describes this distribution.
  */
 #define    MnumrocI( np_, n_, i_, inb_, nb_, proc_, src_, nprocs_ )    \
            {                                                           \
-              if( ( (src_) >= 0 ) && ( (nprocs_) > 1 ) )               \
+              HPL_T_ixmap * map__;                                     \
+              if( ( (i_) >= 0 ) && ( (n_) >= 0 ) &&                    \
+                  ( ( map__ = Mixmap( (i_)+(n_), inb_, nb_, proc_,     \
+                                      src_, nprocs_ ) ) != NULL ) )    \
+              {                                                        \
+                 np_ = map__->cnt[(i_)+(n_)] - map__->cnt[(i_)];       \
+              }                                                        \
+              else if( ( (src_) >= 0 ) && ( (nprocs_) > 1 ) )          \
               {                                                        \
                  int inb__, mydist__, n__, nblk__, quot__, src__;      \
                  if( ( inb__ = (inb_) - (i_) ) <= 0 )                  \
@@ -239,6 +308,18 @@
  * Function prototypes
  * ---------------------------------------------------------------------
  */
+void                             HPL_ixmap_init
+STDC_ARGS( (
+   HPL_T_ixmap *,
+   const int,
+   const int,
+   const int,
+   const int
+) );
+void                             HPL_ixmap_free
+STDC_ARGS( (
+   HPL_T_ixmap *
+) );
 void                             HPL_indxg2lp
 STDC_ARGS( (
    int *,
@@ -312,6 +393,33 @@ STDC_ARGS( (
    const int,
    const int
 ) );
+int                              HPL_numrocW
+STDC_ARGS( (
+   const int,
+   const int,
+   const int,
+   const int,
+   const HPL_T_grid *
+) );
+int                              HPL_indxg2pW
+STDC_ARGS( (
+   const int,
+   const int,
+   const HPL_T_grid *
+) );
+int                              HPL_indxg2lW
+STDC_ARGS( (
+   const int,
+   const int,
+   const HPL_T_grid *
+) );
+int                              HPL_indxl2gW
+STDC_ARGS( (
+   const int,
+   const int,
+   const int,
+   const HPL_T_grid *
+) );
 
 void                             HPL_dlaswp00N
 STDC_ARGS( (
@@ -498,6 +606,19 @@ STDC_ARGS( (
    const double *,
    const int
 ) );
+void                             HPL_pdresid
+STDC_ARGS( (
+   const HPL_T_grid *,
+   const int,
+   const int,
+   const int,
+   const double *,
+   const int,
+   const double *,
+   const HPL_T_PROG_FUN,
+   void *,
+   double *
+) );
 
 #endif
 /*
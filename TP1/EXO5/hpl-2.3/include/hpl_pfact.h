@@ -84,6 +84,16 @@ STDC_ARGS( (
    double *
 ) );
 
+void                             HPL_dlocrk1
+STDC_ARGS( (
+   HPL_T_panel *,
+   const int,
+   const int,
+   const int,
+   const int,
+   const double *,
+   double *
+) );
 void                             HPL_dlocswpN
 STDC_ARGS( (
    HPL_T_panel *,
@@ -155,6 +165,22 @@ STDC_ARGS( (
    const int,
    double *
 ) );
+void                             HPL_pdpanrrN
+STDC_ARGS( (
+   HPL_T_panel *,
+   const int,
+   const int,
+   const int,
+   double *
+) );
+void                             HPL_pdpanrrT
+STDC_ARGS( (
+   HPL_T_panel *,
+   const int,
+   const int,
+   const int,
+   double *
+) );
 
 void                             HPL_pdrpancrN
 STDC_ARGS( (
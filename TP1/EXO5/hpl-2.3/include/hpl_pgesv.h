@@ -74,6 +74,12 @@ typedef enum
    HPL_NO_SWP        = 499
 } HPL_T_SWAP;
 
+typedef enum
+{
+   HPL_ENG_PIPE      = 461,     /* Hand-scheduled look-ahead pipeline */
+   HPL_ENG_DAG       = 462          /* Task graph, work-stealing pool */
+} HPL_T_ENGINE;
+
 typedef struct HPL_S_palg
 {
    HPL_T_TOP           btopo;               /* row broadcast topology */
@@ -89,6 +95,14 @@ typedef struct HPL_S_palg
    int                 fsthr;                   /* Swapping threshold */
    int                 equil;                        /* Equilibration */
    int                 align;              /* data alignment constant */
+   int                 nthrd;             /* # of threads per process */
+   HPL_T_ENGINE        engine;                /* factorization engine */
+   int                 ckpt;     /* checkpoint every ckpt panels or 0 */
+   char                * ckptf;           /* checkpoint file prefix */
+   int                 ooc;      /* out-of-core window in MB, or 0 */
+   char                * oocf;           /* out-of-core file prefix */
+   int                 bprec;  /* L broadcast in single precision if 1 */
+   int                 nrhs;   /* # of right-hand sides solved afterwards */
 } HPL_T_palg;
 
 typedef struct HPL_S_pmat
@@ -98,6 +112,8 @@ typedef struct HPL_S_pmat
 #endif
    double              * A;            /* pointer to local piece of A */
    double              * X;             /* pointer to solution vector */
+   double              * A0;  /* copy of [A|b] for refinement, or NULL */
+   double              * R;  /* L1, DPIV, DINFO of each local panel */
    int                 n;                      /* global problem size */
    int                 nb;                         /* blocking factor */
    int                 ld;                 /* local leading dimension */
@@ -105,6 +121,62 @@ typedef struct HPL_S_pmat
    int                 nq;                 /* local number of columns */
    int                 info;                    /* computational flag */
 } HPL_T_pmat;
+
+typedef struct HPL_S_ckpt
+{
+   char                * name;        /* checkpoint file name prefix */
+   void                * map[2];  /* the two alternating checkpoints */
+   int                 fd   [2];         /* and their file descriptors */
+   int                 key  [24];   /* run parameters (HPL_CKPT_NKEY) */
+   size_t              hlen;               /* header length in bytes */
+   size_t              plen;     /* panel record length in doubles */
+   size_t              len;        /* length of a checkpoint in bytes */
+   int                 every;     /* checkpoint every that many panels */
+   int                 depth;                     /* look-ahead depth */
+   int                 seq;     /* sequence number of last checkpoint */
+   int                 busy;       /* the last checkpoint is in flight */
+   int                 jjs  [2];  /* final local columns in each slot */
+#ifdef HPL_USE_PTHREADS
+   pthread_t           thread;             /* background flush thread */
+#endif
+   double              nbyte;              /* # of bytes checkpointed */
+   double              tsnap;   /* time spent copying into the files */
+   double              tflush;       /* time spent flushing the files */
+   int                 nckpt;             /* # of checkpoints written */
+} HPL_T_ckpt;
+
+typedef struct HPL_S_ckst
+{
+   double              nbyte;             /* # of bytes checkpointed */
+   double              tsnap;  /* time spent copying into the files */
+   double              tflush;      /* time spent flushing the files */
+   int                 nckpt;            /* # of checkpoints written */
+   int                 jrst;   /* column the run resumed at, or -1 */
+} HPL_T_ckst;
+
+typedef struct HPL_S_oost
+{
+   double              rbyte;  /* # of bytes streamed in from the file */
+   double              wbyte;  /* # of bytes streamed out to the file */
+   double              tleft;  /* time in the left-looking updates */
+   double              tslab;   /* time factoring the slabs in-core */
+   int                 nslab;                   /* # of column slabs */
+   int                 width;   /* width of a slab in global columns */
+} HPL_T_oost;
+
+typedef struct HPL_S_mxst
+{
+   double              nbyte;    /* # of bytes of panel received in SP */
+   double              nsave;    /* # of bytes saved by receiving SP */
+   double              rnrm0;   /* scaled residual before refinement */
+   double              rnrm1;    /* scaled residual after refinement */
+   double              tref;           /* time spent in refinement */
+   int                 nstep;  /* # of refinement steps, -1 if none */
+} HPL_T_mxst;
+
+extern HPL_T_ckst                HPL_ckst;
+extern HPL_T_oost                HPL_oost;
+extern HPL_T_mxst                HPL_mxst;
 /*
  * ---------------------------------------------------------------------
  * #define macro constants
@@ -119,6 +191,18 @@ typedef struct HPL_S_pmat
  
 #define    MSGID_BEGIN_COLL    9001
 #define    MSGID_END_COLL     10000
+
+#define    HPL_CKPT_MAGIC   0x48504c43  /* checkpoint file header: */
+#define    HPL_CKPT_VALID        0                   /* valid flag, */
+#define    HPL_CKPT_SEQ          1              /* sequence number, */
+#define    HPL_CKPT_KEY          2               /* run parameters, */
+#define    HPL_CKPT_NKEY        24
+#define    HPL_CKPT_STATE       26  /* HPL_pdgesvK2 loop state, and */
+#define    HPL_CKPT_NSTATE       6
+#define    HPL_CKPT_PANEL       32   /* ia,jb,ja,nq,jj,msgid of each */
+#define    HPL_CKPT_NPANEL       6                /* look-ahead panel */
+
+#define    HPL_NREF_MAX          8  /* max # of refinement steps */
 /*
  * ---------------------------------------------------------------------
  * #define macros definitions
@@ -327,6 +411,111 @@ STDC_ARGS( (
    HPL_T_palg *,
    HPL_T_pmat *
 ) );
+void                             HPL_pdckpt_open
+STDC_ARGS( (
+   HPL_T_ckpt *,
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *
+) );
+void                             HPL_pdckpt_map
+STDC_ARGS( (
+   HPL_T_ckpt *,
+   const int
+) );
+void *                           HPL_pdckpt_flush
+STDC_ARGS( (
+   void *
+) );
+int                              HPL_pdckpt_load
+STDC_ARGS( (
+   HPL_T_ckpt *,
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *,
+   HPL_T_panel * *,
+   int *
+) );
+void                             HPL_pdckpt_save
+STDC_ARGS( (
+   HPL_T_ckpt *,
+   HPL_T_pmat *,
+   HPL_T_panel * *,
+   const int *
+) );
+void                             HPL_pdckpt_close
+STDC_ARGS( (
+   HPL_T_ckpt *,
+   const int
+) );
+void *                           HPL_pdooc_alloc
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   const size_t
+) );
+void                             HPL_pdooc_free
+STDC_ARGS( (
+   HPL_T_palg *,
+   void *,
+   const size_t
+) );
+void                             HPL_pdgesvO
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *
+) );
+void                             HPL_pdgerfs
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *
+) );
+void                             HPL_pdreplay
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *,
+   const int,
+   const int,
+   HPL_T_panel *
+) );
+void                             HPL_pdtrsmL
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *,
+   const int,
+   double *
+) );
+void                             HPL_pdtrsmU
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_pmat *,
+   const int,
+   double *
+) );
+void                             HPL_pdgetrs
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *,
+   const int,
+   double *
+) );
+void                             HPL_pdgesvS
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *
+) );
+void                             HPL_pdgesvD
+STDC_ARGS( (
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *
+) );
 void                             HPL_pdgesv
 STDC_ARGS( (
    HPL_T_grid *,
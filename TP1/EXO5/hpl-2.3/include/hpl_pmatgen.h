@@ -70,6 +70,18 @@ STDC_ARGS( (
    const int,
    const int
 ) );
+void                             HPL_pdmatgenp
+STDC_ARGS( (
+   const HPL_T_grid *,
+   const int,
+   const int,
+   const int,
+   double *,
+   const int,
+   const int,
+   const HPL_T_PROG_FUN,
+   void *
+) );
 
 #endif
 /*
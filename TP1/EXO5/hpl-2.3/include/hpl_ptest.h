@@ -71,6 +71,8 @@ typedef struct HPL_S_test
 {
    double              epsil;                      /* epsilon machine */
    double              thrsh;                            /* threshold */
+   double              wtime;        /* wall time of the last test run */
+   double              gflops;           /* Gflops of the last test run */
    FILE *              outfp;       /* output stream (only in proc 0) */
    int                 kfail;                    /* # of tests failed */
    int                 kpass;                    /* # of tests passed */
@@ -86,6 +88,10 @@ typedef struct HPL_S_test
 #define    HPL_LINE_MAX         256
 #define    HPL_MAX_PARAM         20
 #define    HPL_ISEED            100
+#define    HPL_GROUP_TOL       0.05 /* outlier Gflops / mean, instances */
+#define    HPL_CALIB_N          256  /* order of the calibration DGEMM */
+#define    HPL_CALIB_TIME      0.10 /* seconds of calibration DGEMMs   */
+#define    HPL_CALIB_RES          8  /* blocks per cycle, fastest column */
 /*
  * ---------------------------------------------------------------------
  * global timers for timing analysis only
@@ -93,13 +99,15 @@ typedef struct HPL_S_test
  */
 #ifdef HPL_DETAILED_TIMING
 #define    HPL_TIMING_BEG        11 /* timer 0 reserved, used by main */
-#define    HPL_TIMING_N           6 /* number of timers defined below */
+#define    HPL_TIMING_N           7 /* number of timers defined below */
 #define    HPL_TIMING_RPFACT     11 /* starting from here, contiguous */
 #define    HPL_TIMING_PFACT      12
 #define    HPL_TIMING_MXSWP      13
 #define    HPL_TIMING_UPDATE     14
 #define    HPL_TIMING_LASWP      15
 #define    HPL_TIMING_PTRSV      16
+#define    HPL_TIMING_CKPT       17
+#define    HPL_TIMING_SKEW     0.01 /* straggler delay / run time */
 #endif
 /*
  * ---------------------------------------------------------------------
@@ -110,7 +118,7 @@ void                             HPL_pdinfo
 STDC_ARGS( (
    HPL_T_test *,
    int *,
-   int *,
+   int * *,
    int *,
    int *,
    HPL_T_ORDER *,
@@ -134,7 +142,28 @@ STDC_ARGS( (
    int *,
    int *,
    int *,
-   int *
+   int *,
+   int *,
+   HPL_T_ENGINE *,
+   char *,
+   int *,
+   char *,
+   int *,
+   char *,
+   int *,
+   int *,
+   HPL_T_COLL *,
+   int *,
+   int *,
+   int *,
+   int *,
+   const int,
+   char * *
+) );
+FILE *                           HPL_pdinput
+STDC_ARGS( (
+   const int,
+   char * *
 ) );
 void                             HPL_pdtest
 STDC_ARGS( (
@@ -144,6 +173,55 @@ STDC_ARGS( (
    const int,
    const int
 ) );
+void                             HPL_pdtestk
+STDC_ARGS( (
+   HPL_T_test *,
+   HPL_T_grid *,
+   HPL_T_palg *,
+   HPL_T_pmat *,
+   const double
+) );
+void                             HPL_pdblstat
+STDC_ARGS( (
+   HPL_T_test *,
+   HPL_T_grid *
+) );
+void                             HPL_pdsweep
+STDC_ARGS( (
+   HPL_T_test *,
+   const int,
+   const int,
+   const int *,
+   const int *,
+   const int,
+   const double *
+) );
+void                             HPL_pdgroup
+STDC_ARGS( (
+   HPL_T_test *,
+   const int,
+   const int,
+   const double *
+) );
+void                             HPL_pdcalib
+STDC_ARGS( (
+   HPL_T_test *,
+   HPL_T_grid *,
+   const int,
+   const int *
+) );
+void                             HPL_pdregen
+STDC_ARGS( (
+   const HPL_T_grid *,
+   const int,
+   const int,
+   const int,
+   double *,
+   const int,
+   const double *,
+   const int,
+   double *
+) );
 
 #endif
 /*
@@ -59,16 +59,19 @@
 #define    HPL_NPTIMER             64
 #define    HPL_PTIMER_STARTFLAG   5.0
 #define    HPL_PTIMER_ERROR      -1.0
+#define    HPL_NPTCTR              3
 /*
  * ---------------------------------------------------------------------
  * type definitions
  * ---------------------------------------------------------------------
  */
 typedef enum
-{  HPL_WALL_PTIME = 101, HPL_CPU_PTIME  = 102 } HPL_T_PTIME;
+{  HPL_WALL_PTIME = 101, HPL_CPU_PTIME  = 102, HPL_CYC_PTIME  = 103,
+   HPL_INS_PTIME  = 104, HPL_LLC_PTIME  = 105 } HPL_T_PTIME;
 
 typedef enum
-{ HPL_AMAX_PTIME  = 201, HPL_AMIN_PTIME = 202, HPL_SUM_PTIME  = 203 }
+{ HPL_AMAX_PTIME  = 201, HPL_AMIN_PTIME = 202, HPL_SUM_PTIME  = 203,
+  HPL_STAT_PTIME  = 204 }
 HPL_T_PTIME_OP;
 /*
  * ---------------------------------------------------------------------
@@ -77,6 +80,7 @@ HPL_T_PTIME_OP;
  */
 double          HPL_ptimer_cputime   STDC_ARGS(     ( void      ) );
 double          HPL_ptimer_walltime  STDC_ARGS(     ( void      ) );
+double          HPL_ptimer_counter   STDC_ARGS(     ( const int ) );
 
 void            HPL_ptimer           STDC_ARGS(     ( const int ) );
 void            HPL_ptimer_boot      STDC_ARGS(     ( void      ) );
@@ -0,0 +1,148 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ */ 
+#ifndef HPL_THREAD_H
+#define HPL_THREAD_H
+/*
+ * ---------------------------------------------------------------------
+ * Include files
+ * ---------------------------------------------------------------------
+ */
+#include "hpl_misc.h"
+
+#ifdef HPL_USE_PTHREADS
+#include <pthread.h>
+/*
+ * ---------------------------------------------------------------------
+ * #typedefs and data structures
+ * ---------------------------------------------------------------------
+ */
+typedef struct HPL_S_task
+{
+   int                 (*fun)( struct HPL_S_task * );    /* task body */
+   void                * arg;             /* ptr to the task operands */
+   struct HPL_S_task   * * succ;       /* ptrs to the successor tasks */
+   struct HPL_S_task   * next;            /* next entry in ready list */
+   struct HPL_S_task   * prev;           /* prev. entry in ready list */
+   int                 i;                    /* first task coordinate */
+   int                 j;                   /* second task coordinate */
+   int                 ndep;     /* # of unresolved predecessor tasks */
+   int                 nsucc;                 /* # of successor tasks */
+   int                 mastr;   /* task must run on the master thread */
+   int                 seqno;     /* rank among the master-only tasks */
+   int                 prior;       /* task lies on the critical path */
+} HPL_T_task;
+
+typedef struct HPL_S_tdeq
+{
+   HPL_T_task          * head;               /* oldest entry (stolen) */
+   HPL_T_task          * tail;               /* newest entry (popped) */
+} HPL_T_tdeq;
+
+typedef struct HPL_S_tpool
+{
+   pthread_t           * thread;                    /* worker threads */
+   HPL_T_tdeq          * deque;       /* ready deques, one per thread */
+   pthread_mutex_t     lock;             /* protects the fields below */
+   pthread_cond_t      wake;       /* signaled when the state changes */
+   HPL_T_task          * mlist;    /* master-only ready list (sorted) */
+   HPL_T_task          * plist;           /* master-only tasks polled */
+   int                 mnext;   /* seqno of the next master-only task */
+   int                 nthrd;    /* # of threads including the master */
+   int                 nstrt;                 /* # of started workers */
+   int                 nrdy;        /* # of tasks in the ready deques */
+   int                 npend;         /* # of tasks not yet completed */
+   int                 quit;       /* set when workers must terminate */
+} HPL_T_tpool;
+
+extern int                       HPL_thrd;
+/*
+ * ---------------------------------------------------------------------
+ * Function prototypes
+ * ---------------------------------------------------------------------
+ */
+void                             HPL_tpool_init
+STDC_ARGS( (
+   HPL_T_tpool *,
+   const int
+) );
+void                             HPL_tpool_exit
+STDC_ARGS( (
+   HPL_T_tpool *
+) );
+void                             HPL_tpool_run
+STDC_ARGS( (
+   HPL_T_tpool *,
+   HPL_T_task *,
+   const int
+) );
+void                             HPL_tpool_exec
+STDC_ARGS( (
+   HPL_T_tpool *,
+   HPL_T_task *,
+   const int
+) );
+void                             HPL_tpool_push
+STDC_ARGS( (
+   HPL_T_tpool *,
+   HPL_T_task *,
+   const int
+) );
+HPL_T_task *                     HPL_tpool_take
+STDC_ARGS( (
+   HPL_T_tpool *,
+   const int
+) );
+void *                           HPL_tpool_work
+STDC_ARGS( (
+   void *
+) );
+
+#endif
+
+#endif
+/*
+ * End of hpl_thread.h
+ */
@@ -67,6 +67,131 @@
 #define    HPL_LATCPY_N_DEPTH       2
 #define    HPL_LATCPY_LOG2_N_DEPTH  1
 #endif
+/*
+ * Unless  HPL_LATCPY_USE_COPY  or  HPL_LATCPY_USE_UNROLL  is defined,  the
+ * transpose is done by HPL_LATCPY_NB x HPL_LATCPY_NB blocks,  so that the
+ * rows read from A and the columns written to B stay in cache,  and the
+ * blocks by 4 x 4 tiles transposed in registers.
+ */
+#ifndef HPL_LATCPY_NB
+#define    HPL_LATCPY_NB           64
+#endif
+#if   defined( __AVX__ ) || defined( __SSE2__ )
+#include <immintrin.h>
+#endif
+
+#ifdef STDC_HEADERS
+static void HPL_dlatcpy4
+(
+   const double *                   A,
+   const int                        LDA,
+   double *                         B,
+   const int                        LDB
+)
+#else
+static void HPL_dlatcpy4( A, LDA, B, LDB )
+   const double *                   A;
+   const int                        LDA;
+   double *                         B;
+   const int                        LDB;
+#endif
+{
+/*
+ * B(0:3,0:3) := A(0:3,0:3)^T - the 4 columns of A are loaded, transposed
+ * in registers and stored as the 4 columns of B.
+ */
+#if   defined( __AVX__ )
+   __m256d                    r0, r1, r2, r3, t0, t1, t2, t3;
+
+   r0 = _mm256_loadu_pd( A         ); r1 = _mm256_loadu_pd( A +   LDA );
+   r2 = _mm256_loadu_pd( A + 2*LDA ); r3 = _mm256_loadu_pd( A + 3*LDA );
+   t0 = _mm256_unpacklo_pd( r0, r1 ); t1 = _mm256_unpackhi_pd( r0, r1 );
+   t2 = _mm256_unpacklo_pd( r2, r3 ); t3 = _mm256_unpackhi_pd( r2, r3 );
+   _mm256_storeu_pd( B,         _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+   _mm256_storeu_pd( B +   LDB, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+   _mm256_storeu_pd( B + 2*LDB, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+   _mm256_storeu_pd( B + 3*LDB, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+#elif defined( __SSE2__ )
+   __m128d                    a0, a1, a2, a3, b0, b1, b2, b3;
+
+   a0 = _mm_loadu_pd( A         ); b0 = _mm_loadu_pd( A           + 2 );
+   a1 = _mm_loadu_pd( A +   LDA ); b1 = _mm_loadu_pd( A +   LDA   + 2 );
+   a2 = _mm_loadu_pd( A + 2*LDA ); b2 = _mm_loadu_pd( A + 2*LDA   + 2 );
+   a3 = _mm_loadu_pd( A + 3*LDA ); b3 = _mm_loadu_pd( A + 3*LDA   + 2 );
+   _mm_storeu_pd( B,             _mm_unpacklo_pd( a0, a1 ) );
+   _mm_storeu_pd( B         + 2, _mm_unpacklo_pd( a2, a3 ) );
+   _mm_storeu_pd( B +   LDB,     _mm_unpackhi_pd( a0, a1 ) );
+   _mm_storeu_pd( B +   LDB + 2, _mm_unpackhi_pd( a2, a3 ) );
+   _mm_storeu_pd( B + 2*LDB,     _mm_unpacklo_pd( b0, b1 ) );
+   _mm_storeu_pd( B + 2*LDB + 2, _mm_unpacklo_pd( b2, b3 ) );
+   _mm_storeu_pd( B + 3*LDB,     _mm_unpackhi_pd( b0, b1 ) );
+   _mm_storeu_pd( B + 3*LDB + 2, _mm_unpackhi_pd( b2, b3 ) );
+#else
+   register double            a00, a10, a20, a30, a01, a11, a21, a31,
+                              a02, a12, a22, a32, a03, a13, a23, a33;
+
+   a00 = A[0]; a10 = A[1]; a20 = A[2]; a30 = A[3]; A += LDA;
+   a01 = A[0]; a11 = A[1]; a21 = A[2]; a31 = A[3]; A += LDA;
+   a02 = A[0]; a12 = A[1]; a22 = A[2]; a32 = A[3]; A += LDA;
+   a03 = A[0]; a13 = A[1]; a23 = A[2]; a33 = A[3];
+   B[0] = a00; B[1] = a01; B[2] = a02; B[3] = a03; B += LDB;
+   B[0] = a10; B[1] = a11; B[2] = a12; B[3] = a13; B += LDB;
+   B[0] = a20; B[1] = a21; B[2] = a22; B[3] = a23; B += LDB;
+   B[0] = a30; B[1] = a31; B[2] = a32; B[3] = a33;
+#endif
+}
+
+#ifdef STDC_HEADERS
+static void HPL_dlatcpyB
+(
+   const int                        M,
+   const int                        N,
+   const double *                   A,
+   const int                        LDA,
+   double *                         B,
+   const int                        LDB
+)
+#else
+static void HPL_dlatcpyB( M, N, A, LDA, B, LDB )
+   const int                        M;
+   const int                        N;
+   const double *                   A;
+   const int                        LDA;
+   double *                         B;
+   const int                        LDB;
+#endif
+{
+/*
+ * Blocked transpose:  B(i,j) = A(j,i) for  0 <= i < M  and  0 <= j < N,
+ * by 4 x 4 tiles within every block, the edges being copied one entry
+ * at a time.
+ */
+   const double               * a;
+   double                     * b;
+   int                        i, ib, ie, j, jb, je, mu, nu;
+
+   for( jb = 0; jb < N; jb += HPL_LATCPY_NB )
+   {
+      je = Mmin( N, jb + HPL_LATCPY_NB ); nu = jb + ( ( je - jb ) & ~3 );
+      for( ib = 0; ib < M; ib += HPL_LATCPY_NB )
+      {
+         ie = Mmin( M, ib + HPL_LATCPY_NB ); mu = ib + ( ( ie - ib ) & ~3 );
+         for( j = jb; j < nu; j += 4 )
+         {
+            a = A + j + (size_t)(ib) * LDA; b = B + ib + (size_t)(j) * LDB;
+            for( i = ib; i < mu; i += 4, a += 4 * (size_t)(LDA), b += 4 )
+               HPL_dlatcpy4( a, LDA, b, LDB );
+            for( ; i < ie; i++, a += LDA, b++ )
+            { b[0] = a[0]; b[LDB] = a[1]; b[2*LDB] = a[2]; b[3*LDB] = a[3]; }
+         }
+         for( ; j < je; j++ )
+         {
+            a = A + j + (size_t)(ib) * LDA; b = B + ib + (size_t)(j) * LDB;
+            for( i = ib; i < ie; i++, a += LDA, b++ ) *b = *a;
+         }
+      }
+   }
+}
 
 #ifdef STDC_HEADERS
 void HPL_dlatcpy
@@ -127,9 +252,9 @@ void HPL_dlatcpy
 /*
  * .. Local Variables ..
  */
-#ifdef HPL_LATCPY_USE_COPY
+#if   defined( HPL_LATCPY_USE_COPY )
    register int               j;
-#else
+#elif defined( HPL_LATCPY_USE_UNROLL )
 #if   ( HPL_LATCPY_N_DEPTH == 1 )
    const double               * A0 = A;
    double                     * B0 = B;
@@ -154,8 +279,10 @@ void HPL_dlatcpy
  */
    if( ( M <= 0 ) || ( N <= 0 ) ) return;
 
-#ifdef HPL_LATCPY_USE_COPY
+#if   defined( HPL_LATCPY_USE_COPY )
    for( j = 0; j < N; j++, B0 += LDB ) HPL_dcopy( M, A0+j, LDA, B0, 1 );
+#elif !defined( HPL_LATCPY_USE_UNROLL )
+   HPL_dlatcpyB( M, N, A, LDA, B, LDB );
 #else
    mu = (int)( ( (unsigned int)(M) >> HPL_LATCPY_LOG2_M_DEPTH ) <<
                                       HPL_LATCPY_LOG2_M_DEPTH );
@@ -66,7 +66,7 @@ va_dcl
  * =======
  *
  * HPL_fprintf is a wrapper around fprintf flushing the output stream.
- * 
+ * Nothing is printed when the output stream is NULL.
  *
  * Arguments
  * =========
@@ -106,6 +106,7 @@ va_dcl
    (void) vsprintf( cline, FORM, argptr );
    va_end( argptr ); 
 
+   if( STREAM == NULL ) return;
    (void) fprintf( STREAM, "%s", cline );
    (void) fflush( STREAM );
 /*
@@ -0,0 +1,137 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+
+#ifdef STDC_HEADERS
+void HPL_tpool_exec
+(
+   HPL_T_tpool *                    POOL,
+   HPL_T_task *                     TASK,
+   const int                        ID
+)
+#else
+void HPL_tpool_exec
+( POOL, TASK, ID )
+   HPL_T_tpool *                    POOL;
+   HPL_T_task *                     TASK;
+   const int                        ID;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_exec  executes the task TASK  and releases its successors:
+ * the  dependency  count of every successor  is decremented,  and those
+ * reaching zero are pushed in the pool.  The successors that lie on the
+ * critical path are pushed last, so that the calling thread executes
+ * them next.  A master-only task may return  HPL_KEEP_TESTING,  when it
+ * waits for a message for instance.  It is then added to the list of
+ * tasks in progress,  and called again later on by the master thread.
+ * This function must be called with the pool lock released.
+ *
+ * Arguments
+ * =========
+ *
+ * POOL    (local input/output)          HPL_T_tpool *
+ *         On entry, POOL points to the pool executing the task graph.
+ *
+ * TASK    (local input/output)          HPL_T_task *
+ *         On entry, TASK points to the task to execute. All its prede-
+ *         cessors must have completed.
+ *
+ * ID      (local input)                 const int
+ *         On entry, ID specifies the index of the calling thread in the
+ *         pool, 0 being the master thread.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_task                 * s;
+   int                        k;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( TASK->fun( TASK ) != HPL_SUCCESS )
+   {
+      (void) pthread_mutex_lock( &(POOL->lock) );
+      TASK->next = POOL->plist; POOL->plist = TASK;
+      (void) pthread_mutex_unlock( &(POOL->lock) );
+      return;
+   }
+
+   (void) pthread_mutex_lock( &(POOL->lock) );
+
+   for( k = 0; k < TASK->nsucc; k++ )
+   {
+      s = TASK->succ[k];
+      if( ( --(s->ndep) == 0 ) && ( s->prior == 0 ) )
+         HPL_tpool_push( POOL, s, ID );
+   }
+   for( k = 0; k < TASK->nsucc; k++ )
+   {
+      s = TASK->succ[k];
+      if( ( s->ndep == 0 ) && ( s->prior != 0 ) )
+         HPL_tpool_push( POOL, s, ID );
+   }
+   POOL->npend--;
+
+   (void) pthread_cond_broadcast( &(POOL->wake) );
+   (void) pthread_mutex_unlock( &(POOL->lock) );
+/*
+ * End of HPL_tpool_exec
+ */
+}
+
+#endif
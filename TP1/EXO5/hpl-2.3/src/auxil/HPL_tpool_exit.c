@@ -0,0 +1,108 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+
+#ifdef STDC_HEADERS
+void HPL_tpool_exit
+(
+   HPL_T_tpool *                    POOL
+)
+#else
+void HPL_tpool_exit
+( POOL )
+   HPL_T_tpool *                    POOL;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_exit terminates and joins the worker threads of  the  pool
+ * and releases the resources allocated by HPL_tpool_init.
+ *
+ * Arguments
+ * =========
+ *
+ * POOL    (local input/output)          HPL_T_tpool *
+ *         On entry,  POOL  points  to the pool to release.  No task
+ *         graph must be in flight.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   int                        i;
+/* ..
+ * .. Executable Statements ..
+ */
+   (void) pthread_mutex_lock( &(POOL->lock) );
+   POOL->quit = 1;
+   (void) pthread_cond_broadcast( &(POOL->wake) );
+   (void) pthread_mutex_unlock( &(POOL->lock) );
+
+   if( POOL->thread )
+   {
+      for( i = 0; i < POOL->nthrd - 1; i++ )
+         (void) pthread_join( POOL->thread[i], NULL );
+      free( POOL->thread ); POOL->thread = NULL;
+   }
+   if( POOL->deque ) { free( POOL->deque ); POOL->deque = NULL; }
+
+   (void) pthread_cond_destroy(  &(POOL->wake) );
+   (void) pthread_mutex_destroy( &(POOL->lock) );
+/*
+ * End of HPL_tpool_exit
+ */
+}
+
+#endif
@@ -0,0 +1,147 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+/*
+ * Threads other than the one calling MPI may be started, unless the dri-
+ * ver finds that MPI does not provide MPI_THREAD_FUNNELED
+ */
+int                                 HPL_thrd = 1;
+
+#ifdef STDC_HEADERS
+void HPL_tpool_init
+(
+   HPL_T_tpool *                    POOL,
+   const int                        NTHRD
+)
+#else
+void HPL_tpool_init
+( POOL, NTHRD )
+   HPL_T_tpool *                    POOL;
+   const int                        NTHRD;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_init creates a pool of NTHRD-1 worker threads. The calling
+ * thread is the master thread of the pool:  it takes part in the execu-
+ * tion of the task graphs submitted with HPL_tpool_run and it  is  the
+ * only thread that executes the tasks flagged as master-only, i.e.  the
+ * tasks performing MPI calls.  Every thread owns a deque of ready tasks
+ * and steals work from the others  when its deque is empty.  The wor-
+ * kers sleep until tasks are ready.
+ *
+ * Arguments
+ * =========
+ *
+ * POOL    (local output)                HPL_T_tpool *
+ *         On entry,  POOL  points  to the data structure to initialize.
+ *         On exit, the worker threads are running and waiting for work.
+ *
+ * NTHRD   (local input)                 const int
+ *         On entry,  NTHRD  specifies the total number of threads,  the
+ *         master included.  When NTHRD is less than 2,  no worker is
+ *         created and all tasks are executed by the master thread.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   int                        i;
+/* ..
+ * .. Executable Statements ..
+ */
+   POOL->nthrd = Mmax( 1, NTHRD ); POOL->npend = 0; POOL->quit = 0;
+   POOL->nstrt = 0; POOL->nrdy  = 0; POOL->mnext = 0;
+   POOL->mlist = POOL->plist = NULL;
+   POOL->thread = NULL;
+
+   POOL->deque = (HPL_T_tdeq *)malloc( (size_t)(POOL->nthrd) *
+                                       sizeof( HPL_T_tdeq ) );
+   if( POOL->deque == NULL )
+   {
+      HPL_abort( __LINE__, "HPL_tpool_init",
+                 "Memory allocation failed" );
+   }
+   for( i = 0; i < POOL->nthrd; i++ )
+      POOL->deque[i].head = POOL->deque[i].tail = NULL;
+
+   (void) pthread_mutex_init( &(POOL->lock), NULL );
+   (void) pthread_cond_init(  &(POOL->wake), NULL );
+
+   if( POOL->nthrd == 1 ) return;
+
+   POOL->thread = (pthread_t *)malloc( (size_t)(POOL->nthrd - 1) *
+                                       sizeof( pthread_t ) );
+   if( POOL->thread == NULL )
+   {
+      HPL_abort( __LINE__, "HPL_tpool_init",
+                 "Memory allocation failed" );
+   }
+
+   for( i = 0; i < POOL->nthrd - 1; i++ )
+   {
+      if( pthread_create( &(POOL->thread[i]), NULL, HPL_tpool_work,
+                          (void *)(POOL) ) != 0 )
+      {
+         HPL_abort( __LINE__, "HPL_tpool_init",
+                    "Thread creation failed" );
+      }
+   }
+/*
+ * End of HPL_tpool_init
+ */
+}
+
+#endif
@@ -0,0 +1,121 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+
+#ifdef STDC_HEADERS
+void HPL_tpool_push
+(
+   HPL_T_tpool *                    POOL,
+   HPL_T_task *                     TASK,
+   const int                        ID
+)
+#else
+void HPL_tpool_push
+( POOL, TASK, ID )
+   HPL_T_tpool *                    POOL;
+   HPL_T_task *                     TASK;
+   const int                        ID;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_push  inserts a ready task in the pool.  A master-only task
+ * is inserted in the master list,  which is kept sorted by  increasing
+ * sequence number.  Any other task is appended to the tail of the deque
+ * of the thread ID,  from where it is popped  by that thread first,  or
+ * stolen from the head by the other threads when they run out of work.
+ * This function must be called with the pool lock held.
+ *
+ * Arguments
+ * =========
+ *
+ * POOL    (local input/output)          HPL_T_tpool *
+ *         On entry, POOL points to the pool executing the task graph.
+ *
+ * TASK    (local input/output)          HPL_T_task *
+ *         On entry,  TASK points to a task whose dependency count is
+ *         zero.
+ *
+ * ID      (local input)                 const int
+ *         On entry, ID specifies the index of the calling thread in the
+ *         pool, 0 being the master thread.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_task                 * * tp;
+   HPL_T_tdeq                 * dq;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( TASK->mastr )
+   {
+      for( tp = &(POOL->mlist); ( *tp != NULL ) &&
+           ( (*tp)->seqno < TASK->seqno ); tp = &((*tp)->next) );
+      TASK->next = *tp; *tp = TASK;
+      return;
+   }
+
+   dq = POOL->deque + ID; TASK->next = NULL; TASK->prev = dq->tail;
+   if( dq->tail == NULL ) dq->head       = TASK;
+   else                   dq->tail->next = TASK;
+   dq->tail = TASK; POOL->nrdy++;
+/*
+ * End of HPL_tpool_push
+ */
+}
+
+#endif
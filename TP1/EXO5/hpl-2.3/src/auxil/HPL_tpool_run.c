@@ -0,0 +1,166 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+
+#ifdef STDC_HEADERS
+void HPL_tpool_run
+(
+   HPL_T_tpool *                    POOL,
+   HPL_T_task *                     TASKS,
+   const int                        NTASK
+)
+#else
+void HPL_tpool_run
+( POOL, TASKS, NTASK )
+   HPL_T_tpool *                    POOL;
+   HPL_T_task *                     TASKS;
+   const int                        NTASK;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_run executes a task graph and returns when all its tasks
+ * have completed.  The tasks whose dependency count is zero are queued
+ * first; the others become ready as their predecessors complete.
+ *
+ * The master thread executes the master-only tasks,  i.e.  the tasks
+ * performing MPI calls, strictly in the order of their sequence numbers
+ * so that  all processes  issue their communications  in a consistent
+ * order.  In between, it polls the communications in progress and helps
+ * the workers with the other tasks.
+ *
+ * Arguments
+ * =========
+ *
+ * POOL    (local input/output)          HPL_T_tpool *
+ *         On entry,  POOL  points  to a pool created by HPL_tpool_init.
+ *
+ * TASKS   (local input/output)          HPL_T_task *
+ *         On entry,  TASKS  is an array of dimension NTASK  containing
+ *         the task graph.  The fields fun, arg, succ, nsucc, ndep,
+ *         mastr and prior of every task must be set. The master-only
+ *         tasks must be numbered 0, 1, ... in their field seqno.  On
+ *         exit, the dependency counts are all zero.
+ *
+ * NTASK   (local input)                 const int
+ *         On entry, NTASK specifies the number of tasks in the graph.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_task                 * n, * t;
+   int                        k;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( NTASK <= 0 ) return;
+
+   (void) pthread_mutex_lock( &(POOL->lock) );
+
+   POOL->npend = NTASK; POOL->mnext = 0; POOL->plist = NULL;
+   for( k = 0; k < NTASK; k++ )
+   { if( TASKS[k].ndep == 0 ) HPL_tpool_push( POOL, TASKS + k, 0 ); }
+   (void) pthread_cond_broadcast( &(POOL->wake) );
+
+   while( POOL->npend > 0 )
+   {
+/*
+ * Next master-only task in sequence
+ */
+      t = POOL->mlist;
+      if( ( t != NULL ) && ( t->seqno == POOL->mnext ) )
+      {
+         POOL->mlist = t->next; POOL->mnext++;
+         (void) pthread_mutex_unlock( &(POOL->lock) );
+         HPL_tpool_exec( POOL, t, 0 );
+         (void) pthread_mutex_lock( &(POOL->lock) );
+         continue;
+      }
+/*
+ * Progress the communications
+ */
+      if( ( t = POOL->plist ) != NULL )
+      {
+         POOL->plist = NULL;
+         (void) pthread_mutex_unlock( &(POOL->lock) );
+         while( t != NULL )
+         { n = t->next; HPL_tpool_exec( POOL, t, 0 ); t = n; }
+         (void) pthread_mutex_lock( &(POOL->lock) );
+      }
+/*
+ * Help the workers - Sleep only when nothing needs to be polled
+ */
+      if( ( t = HPL_tpool_take( POOL, 0 ) ) != NULL )
+      {
+         (void) pthread_mutex_unlock( &(POOL->lock) );
+         HPL_tpool_exec( POOL, t, 0 );
+         (void) pthread_mutex_lock( &(POOL->lock) );
+      }
+      else if( ( POOL->plist == NULL ) && ( POOL->npend > 0 ) &&
+               ( ( POOL->mlist == NULL ) ||
+                 ( POOL->mlist->seqno != POOL->mnext ) ) )
+      {
+         (void) pthread_cond_wait( &(POOL->wake), &(POOL->lock) );
+      }
+   }
+
+   (void) pthread_mutex_unlock( &(POOL->lock) );
+/*
+ * End of HPL_tpool_run
+ */
+}
+
+#endif
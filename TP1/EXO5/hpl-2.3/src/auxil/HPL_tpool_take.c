@@ -0,0 +1,127 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+
+#ifdef STDC_HEADERS
+HPL_T_task * HPL_tpool_take
+(
+   HPL_T_tpool *                    POOL,
+   const int                        ID
+)
+#else
+HPL_T_task * HPL_tpool_take
+( POOL, ID )
+   HPL_T_tpool *                    POOL;
+   const int                        ID;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_take removes a ready task from the deques of the pool.  The
+ * thread  ID  pops the newest entry of its own deque,  i.e. the task it
+ * most recently released  and whose operands are likely to be still in
+ * cache.  When its deque is empty, it steals the oldest entry of one of
+ * the other deques,  visited in a round robin fashion.  This function
+ * must be called with the pool lock held.
+ *
+ * Arguments
+ * =========
+ *
+ * POOL    (local input/output)          HPL_T_tpool *
+ *         On entry, POOL points to the pool executing the task graph.
+ *
+ * ID      (local input)                 const int
+ *         On entry, ID specifies the index of the calling thread in the
+ *         pool, 0 being the master thread.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_task                 * t;
+   HPL_T_tdeq                 * dq;
+   int                        k;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( POOL->nrdy == 0 ) return( NULL );
+
+   dq = POOL->deque + ID;
+   if( ( t = dq->tail ) != NULL )
+   {
+      dq->tail = t->prev;
+      if( dq->tail == NULL ) dq->head       = NULL;
+      else                   dq->tail->next = NULL;
+      POOL->nrdy--; return( t );
+   }
+
+   for( k = 1; k < POOL->nthrd; k++ )
+   {
+      dq = POOL->deque + ( ID + k ) % POOL->nthrd;
+      if( ( t = dq->head ) != NULL )
+      {
+         dq->head = t->next;
+         if( dq->head == NULL ) dq->tail       = NULL;
+         else                   dq->head->prev = NULL;
+         POOL->nrdy--; return( t );
+      }
+   }
+   return( NULL );
+/*
+ * End of HPL_tpool_take
+ */
+}
+
+#endif
@@ -0,0 +1,114 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+
+#ifdef STDC_HEADERS
+void * HPL_tpool_work
+(
+   void *                           ARG
+)
+#else
+void * HPL_tpool_work
+( ARG )
+   void *                           ARG;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_tpool_work is the start routine of the worker threads.  A worker
+ * repeatedly takes a task from its own deque,  or steals one from the
+ * deques of the other threads, and executes it. It goes to sleep when
+ * all deques are empty.  Workers never execute master-only tasks.  The
+ * routine returns when the pool is released.
+ *
+ * Arguments
+ * =========
+ *
+ * ARG     (local input/output)          void *
+ *         On entry, ARG points to the pool the worker belongs to.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_tpool                * pool = (HPL_T_tpool *)(ARG);
+   HPL_T_task                 * t;
+   int                        id;
+/* ..
+ * .. Executable Statements ..
+ */
+   (void) pthread_mutex_lock( &(pool->lock) );
+   id = ++(pool->nstrt);
+
+   for( ;; )
+   {
+      while( ( pool->quit == 0 ) &&
+             ( ( t = HPL_tpool_take( pool, id ) ) == NULL ) )
+         (void) pthread_cond_wait( &(pool->wake), &(pool->lock) );
+      if( pool->quit != 0 ) break;
+
+      (void) pthread_mutex_unlock( &(pool->lock) );
+      HPL_tpool_exec( pool, t, id );
+      (void) pthread_mutex_lock( &(pool->lock) );
+   }
+
+   (void) pthread_mutex_unlock( &(pool->lock) );
+   return( NULL );
+/*
+ * End of HPL_tpool_work
+ */
+}
+
+#endif
@@ -0,0 +1,131 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_CALL_DLBLAS
+
+#include <dlfcn.h>
+/*
+ * The run-time BLAS table,  initially empty:  every routine uses the
+ * kernels built into HPL until HPL_blas_init loads a library.
+ */
+HPL_T_blas                          HPL_blas = { NULL, "builtin" };
+/*
+ * Resolve a cblas_* entry point (POSIX idiom for function pointers)
+ */
+#define HPL_BLAS_SYM( fun_ ) \
+   *(void **)(&(HPL_blas.fun_)) = dlsym( HPL_blas.handle, "cblas_" #fun_ )
+
+#ifdef STDC_HEADERS
+int HPL_blas_init
+(
+   const char *                     NAME
+)
+#else
+int HPL_blas_init
+( NAME )
+   const char *                     NAME;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_blas_init selects the BLAS backend used by the HPL_d* wrappers.
+ * When NAME is the string "builtin", the kernels built into HPL are
+ * used.  Otherwise NAME is the path of a shared library exporting the
+ * C interface of the BLAS  (cblas_dgemm, ...), which is opened with
+ * dlopen.  If the library cannot be opened  or  does not provide every
+ * routine HPL needs,  the built-in kernels are kept and  HPL_FAILURE is
+ * returned. In every case the BLAS call statistics are reset.
+ *
+ * Arguments
+ * =========
+ *
+ * NAME    (local input)                 const char *
+ *         On entry,  NAME  is either "builtin" or the path of a shared
+ *         library. A NULL pointer or an empty string selects the built-
+ *         in kernels.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/* ..
+ * .. Executable Statements ..
+ */
+   HPL_blas_exit(); HPL_blas_reset();
+
+   if( ( NAME == NULL ) || ( *NAME == '\0' ) ||
+       ( strcmp( NAME, "builtin" ) == 0 ) ) return( HPL_SUCCESS );
+
+   HPL_blas.handle = dlopen( NAME, RTLD_NOW | RTLD_LOCAL );
+   if( HPL_blas.handle == NULL ) return( HPL_FAILURE );
+
+   HPL_BLAS_SYM( dcopy ); HPL_BLAS_SYM( daxpy ); HPL_BLAS_SYM( dscal );
+   HPL_BLAS_SYM( idamax );
+   HPL_BLAS_SYM( dgemv ); HPL_BLAS_SYM( dtrsv ); HPL_BLAS_SYM( dger  );
+   HPL_BLAS_SYM( dgemm ); HPL_BLAS_SYM( dtrsm );
+
+   if( ( HPL_blas.dcopy == NULL ) || ( HPL_blas.daxpy  == NULL ) ||
+       ( HPL_blas.dscal == NULL ) || ( HPL_blas.idamax == NULL ) ||
+       ( HPL_blas.dgemv == NULL ) || ( HPL_blas.dtrsv  == NULL ) ||
+       ( HPL_blas.dger  == NULL ) || ( HPL_blas.dgemm  == NULL ) ||
+       ( HPL_blas.dtrsm == NULL ) )
+   { HPL_blas_exit(); return( HPL_FAILURE ); }
+
+   (void) strncpy( HPL_blas.name, NAME, HPL_BLAS_NAMLEN - 1 );
+   HPL_blas.name[HPL_BLAS_NAMLEN-1] = '\0';
+
+   return( HPL_SUCCESS );
+/*
+ * End of HPL_blas_init
+ */
+}
+
+#endif
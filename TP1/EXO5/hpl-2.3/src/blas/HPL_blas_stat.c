@@ -0,0 +1,131 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_BLAS_STATS
+
+#ifdef HPL_USE_PTHREADS
+static pthread_mutex_t              HPL_blas_lock =
+                                    PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+#ifdef STDC_HEADERS
+void HPL_blas_stat
+(
+   const int                        FUN,
+   const int                        DIM,
+   const double                     FLOPS,
+   const double                     T0
+)
+#else
+void HPL_blas_stat
+( FUN, DIM, FLOPS, T0 )
+   const int                        FUN;
+   const int                        DIM;
+   const double                     FLOPS;
+   const double                     T0;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_blas_stat records the completion of a call to the BLAS routine
+ * FUN started at the wall clock time T0.  The calls  made  by  several
+ * threads of a process are serialized,  so that the recorded times are
+ * aggregated over the threads.
+ *
+ * Arguments
+ * =========
+ *
+ * FUN     (local input)                 const int
+ *         On entry,  FUN  identifies the routine  (HPL_BLAS_DCOPY, ...,
+ *         HPL_BLAS_DTRSM).
+ *
+ * DIM     (local input)                 const int
+ *         On entry,  DIM  is the smallest dimension of the operands; it
+ *         selects the bin of the shape histogram.
+ *
+ * FLOPS   (local input)                 const double
+ *         On entry, FLOPS is the number of floating point operations
+ *         performed by the call.
+ *
+ * T0      (local input)                 const double
+ *         On entry, T0 is the value returned by HPL_timer_walltime when
+ *         the call started.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   double                     t;
+   int                        b, d;
+/* ..
+ * .. Executable Statements ..
+ */
+   t = HPL_timer_walltime() - T0;
+   for( b = 0, d = DIM; ( d > 1 ) && ( b < HPL_BLAS_NBIN - 1 ); b++ )
+      d >>= 1;
+#ifdef HPL_USE_PTHREADS
+   (void) pthread_mutex_lock( &HPL_blas_lock );
+#endif
+   HPL_blst.ncall[FUN][b] += HPL_rone;
+   HPL_blst.flops[FUN][b] += FLOPS;
+   HPL_blst.time [FUN][b] += t;
+#ifdef HPL_USE_PTHREADS
+   (void) pthread_mutex_unlock( &HPL_blas_lock );
+#endif
+/*
+ * End of HPL_blas_stat
+ */
+}
+
+#endif
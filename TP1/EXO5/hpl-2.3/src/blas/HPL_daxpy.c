@@ -51,6 +51,77 @@
 
 #ifndef HPL_daxpy
 
+#ifdef HPL_USE_BUILTIN_BLAS
+
+#ifdef STDC_HEADERS
+static void HPL_daxpy0
+(
+   const int                        N,
+   const double                     ALPHA,
+   const double *                   X,
+   const int                        INCX,
+   double *                         Y,
+   const int                        INCY
+)
+#else
+static void HPL_daxpy0
+( N, ALPHA, X, INCX, Y, INCY )
+   const int                        N;
+   const double                     ALPHA;
+   const double *                   X;
+   const int                        INCX;
+   double *                         Y;
+   const int                        INCY;
+#endif
+{
+/*
+ * .. Local Variables ..
+ */
+   register const double     alpha = ALPHA;
+   register double           x0, x1, x2, x3, y0, y1, y2, y3;
+   const double              * StX;
+   register int              i;
+   int                       nu;
+   const int                 incX2 = 2 * INCX, incY2 = 2 * INCY,
+                             incX3 = 3 * INCX, incY3 = 3 * INCY,
+                             incX4 = 4 * INCX, incY4 = 4 * INCY;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( N > 0 ) && ( alpha != HPL_rzero ) )
+   {
+      if( ( nu = ( N >> 2 ) << 2 ) != 0 )
+      {
+         StX = X + nu * INCX;
+ 
+         do
+         {
+            x0 = (*X);     y0 = (*Y);     x1 = X[INCX ]; y1 = Y[INCY ];
+            x2 = X[incX2]; y2 = Y[incY2]; x3 = X[incX3]; y3 = Y[incY3];
+ 
+            *Y       = y0 + alpha * x0; Y[INCY ] = y1 + alpha * x1;
+            Y[incY2] = y2 + alpha * x2; Y[incY3] = y3 + alpha * x3;
+ 
+            X  += incX4;
+            Y  += incY4;
+ 
+         } while( X != StX );
+      }
+ 
+      for( i = N - nu; i != 0; i-- )
+      {
+         x0  = (*X);
+         y0  = (*Y);
+ 
+         *Y  = y0 + alpha * x0;
+ 
+         X  += INCX;
+         Y  += INCY;
+      }
+   }
+}
+#endif
+
 #ifdef STDC_HEADERS
 void HPL_daxpy
 (
@@ -111,50 +182,21 @@ void HPL_daxpy
  *
  * ---------------------------------------------------------------------
  */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
 #ifdef HPL_CALL_CBLAS
    cblas_daxpy( N, ALPHA, X, INCX, Y, INCY );
 #endif
-#ifdef HPL_CALL_VSIPL
-   register const double     alpha = ALPHA;
-   register double           x0, x1, x2, x3, y0, y1, y2, y3;
-   const double              * StX;
-   register int              i;
-   int                       nu;
-   const int                 incX2 = 2 * INCX, incY2 = 2 * INCY,
-                             incX3 = 3 * INCX, incY3 = 3 * INCY,
-                             incX4 = 4 * INCX, incY4 = 4 * INCY;
-
-   if( ( N > 0 ) && ( alpha != HPL_rzero ) )
-   {
-      if( ( nu = ( N >> 2 ) << 2 ) != 0 )
-      {
-         StX = X + nu * INCX;
- 
-         do
-         {
-            x0 = (*X);     y0 = (*Y);     x1 = X[INCX ]; y1 = Y[INCY ];
-            x2 = X[incX2]; y2 = Y[incY2]; x3 = X[incX3]; y3 = Y[incY3];
- 
-            *Y       = y0 + alpha * x0; Y[INCY ] = y1 + alpha * x1;
-            Y[incY2] = y2 + alpha * x2; Y[incY3] = y3 + alpha * x3;
- 
-            X  += incX4;
-            Y  += incY4;
- 
-         } while( X != StX );
-      }
- 
-      for( i = N - nu; i != 0; i-- )
-      {
-         x0  = (*X);
-         y0  = (*Y);
- 
-         *Y  = y0 + alpha * x0;
- 
-         X  += INCX;
-         Y  += INCY;
-      }
-   }
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.daxpy != NULL )
+      HPL_blas.daxpy( N, ALPHA, X, INCX, Y, INCY );
+   else
+      HPL_daxpy0( N, ALPHA, X, INCX, Y, INCY );
+#else
+   HPL_daxpy0( N, ALPHA, X, INCX, Y, INCY );
+#endif
 #endif
 #ifdef HPL_CALL_FBLAS
    double                    alpha = ALPHA;
@@ -167,6 +209,9 @@ void HPL_daxpy
 #endif
    F77daxpy( &F77N, &alpha, X, &F77incx, Y, &F77incy );
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DAXPY, N, 2.0 * (double)(N), t0 );
+#endif
 /*
  * End of HPL_daxpy
  */
@@ -51,8 +51,10 @@
 
 #ifndef HPL_dcopy
 
+#ifdef HPL_USE_BUILTIN_BLAS
+
 #ifdef STDC_HEADERS
-void HPL_dcopy
+static void HPL_dcopy0
 (
    const int                        N,
    const double *                   X,
@@ -61,7 +63,7 @@ void HPL_dcopy
    const int                        INCY
 )
 #else
-void HPL_dcopy
+static void HPL_dcopy0
 ( N, X, INCX, Y, INCY )
    const int                        N;
    const double *                   X;
@@ -70,44 +72,9 @@ void HPL_dcopy
    const int                        INCY;
 #endif
 {
-/* 
- * Purpose
- * =======
- *
- * HPL_dcopy copies the vector x into the vector y.
- * 
- *
- * Arguments
- * =========
- *
- * N       (local input)                 const int
- *         On entry, N specifies the length of the vectors  x  and  y. N
- *         must be at least zero.
- *
- * X       (local input)                 const double *
- *         On entry,  X  is an incremented array of dimension  at  least
- *         ( 1 + ( n - 1 ) * abs( INCX ) )  that  contains the vector x.
- *
- * INCX    (local input)                 const int
- *         On entry, INCX specifies the increment for the elements of X.
- *         INCX must not be zero.
- *
- * Y       (local input/output)          double *
- *         On entry,  Y  is an incremented array of dimension  at  least
- *         ( 1 + ( n - 1 ) * abs( INCY ) )  that  contains the vector y.
- *         On exit, the entries of the incremented array  Y  are updated
- *         with the entries of the incremented array X.
- *
- * INCY    (local input)                 const int
- *         On entry, INCY specifies the increment for the elements of Y.
- *         INCY must not be zero.
- *
- * ---------------------------------------------------------------------
- */ 
-#ifdef HPL_CALL_CBLAS
-   cblas_dcopy( N, X, INCX, Y, INCY );
-#endif
-#ifdef HPL_CALL_VSIPL
+/*
+ * .. Local Variables ..
+ */
    register double           x0, x1, x2, x3, x4, x5, x6, x7;
    const double              * StX;
    register int              i;
@@ -119,7 +86,9 @@ void HPL_dcopy
                              incX6 = 6 * INCX, incY6 = 6 * INCY,
                              incX7 = 7 * INCX, incY7 = 7 * INCY,
                              incX8 = 8 * INCX, incY8 = 8 * INCY;
-
+/* ..
+ * .. Executable Statements ..
+ */
    if( N > 0 )
    {
       if( ( nu = ( N >> 3 ) << 3 ) != 0 )
@@ -149,6 +118,77 @@ void HPL_dcopy
          Y  += INCY;
       }
    }
+}
+#endif
+
+#ifdef STDC_HEADERS
+void HPL_dcopy
+(
+   const int                        N,
+   const double *                   X,
+   const int                        INCX,
+   double *                         Y,
+   const int                        INCY
+)
+#else
+void HPL_dcopy
+( N, X, INCX, Y, INCY )
+   const int                        N;
+   const double *                   X;
+   const int                        INCX;
+   double *                         Y;
+   const int                        INCY;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_dcopy copies the vector x into the vector y.
+ * 
+ *
+ * Arguments
+ * =========
+ *
+ * N       (local input)                 const int
+ *         On entry, N specifies the length of the vectors  x  and  y. N
+ *         must be at least zero.
+ *
+ * X       (local input)                 const double *
+ *         On entry,  X  is an incremented array of dimension  at  least
+ *         ( 1 + ( n - 1 ) * abs( INCX ) )  that  contains the vector x.
+ *
+ * INCX    (local input)                 const int
+ *         On entry, INCX specifies the increment for the elements of X.
+ *         INCX must not be zero.
+ *
+ * Y       (local input/output)          double *
+ *         On entry,  Y  is an incremented array of dimension  at  least
+ *         ( 1 + ( n - 1 ) * abs( INCY ) )  that  contains the vector y.
+ *         On exit, the entries of the incremented array  Y  are updated
+ *         with the entries of the incremented array X.
+ *
+ * INCY    (local input)                 const int
+ *         On entry, INCY specifies the increment for the elements of Y.
+ *         INCY must not be zero.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
+#ifdef HPL_CALL_CBLAS
+   cblas_dcopy( N, X, INCX, Y, INCY );
+#endif
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dcopy != NULL )
+      HPL_blas.dcopy( N, X, INCX, Y, INCY );
+   else
+      HPL_dcopy0( N, X, INCX, Y, INCY );
+#else
+   HPL_dcopy0( N, X, INCX, Y, INCY );
+#endif
 #endif
 #ifdef HPL_CALL_FBLAS
 #ifdef HPL_USE_F77_INTEGER_DEF
@@ -160,6 +200,9 @@ void HPL_dcopy
 #endif
    F77dcopy( &F77N, X, &F77incx, Y, &F77incy );
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DCOPY, N, HPL_rzero, t0 );
+#endif
 /*
  * End of HPL_dcopy
  */
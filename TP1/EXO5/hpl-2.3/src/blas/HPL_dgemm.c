@@ -51,7 +51,7 @@
 
 #ifndef HPL_dgemm
 
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
 
 #ifdef STDC_HEADERS
 static void HPL_dgemmNN
@@ -209,6 +209,351 @@ static void HPL_dgemmTT( M, N, K, ALPHA, A, LDA, B, LDB, BETA, C, LDC )
    }
 }
 
+/*
+ * Built-in packed DGEMM engine.  op(A) and op(B) are copied block by
+ * block into contiguous buffers (a KC x NC panel of B, then a MC x KC
+ * block of A),  such that the micro-kernel  streams through unit-stride
+ * memory  and  computes a MR x NR tile of C in registers.  Transposition
+ * is handled once, at packing time.
+ */
+#if   defined( __AVX512F__ )
+#include <immintrin.h>
+#define    HPL_DGEMM_MR            16
+#define    HPL_DGEMM_NR             6
+#elif defined( __AVX2__ ) && defined( __FMA__ )
+#include <immintrin.h>
+#define    HPL_DGEMM_MR             8
+#define    HPL_DGEMM_NR             6
+#else
+#define    HPL_DGEMM_MR             4
+#define    HPL_DGEMM_NR             4
+#endif
+
+#ifndef HPL_DGEMM_KC
+#define    HPL_DGEMM_KC           256
+#endif
+#ifndef HPL_DGEMM_MC
+#define    HPL_DGEMM_MC           144
+#endif
+#ifndef HPL_DGEMM_NC
+#define    HPL_DGEMM_NC          3072
+#endif
+/*
+ * Problems with less than HPL_DGEMM_SMALL multiply-adds  are not worth
+ * the packing and are handled by the plain loops above.
+ */
+#ifndef HPL_DGEMM_SMALL
+#define    HPL_DGEMM_SMALL      32768
+#endif
+
+#ifdef STDC_HEADERS
+static void HPL_dgepackA
+(
+   const enum HPL_TRANS       TRANS,
+   const int                  M,
+   const int                  K,
+   const double               * A,
+   const int                  LDA,
+   double                     * AP
+)
+#else
+static void HPL_dgepackA( TRANS, M, K, A, LDA, AP )
+   const enum HPL_TRANS       TRANS;
+   const int                  K, LDA, M;
+   const double               * A;
+   double                     * AP;
+#endif
+{
+/*
+ * Pack the M x K matrix op(A) into row panels of HPL_DGEMM_MR rows, the
+ * entries of a column of each panel being contiguous. The last panel is
+ * padded with zeros.
+ */
+   const double               * a;
+   int                        i, l, mr, r;
+
+   for( i = 0; i < M; i += HPL_DGEMM_MR, AP += HPL_DGEMM_MR * K )
+   {
+      mr = Mmin( HPL_DGEMM_MR, M - i );
+      if( TRANS == HplNoTrans )
+      {
+         for( l = 0; l < K; l++ )
+         {
+            a = A + i + (size_t)(l) * LDA;
+            for( r = 0;  r < mr;           r++ ) AP[l*HPL_DGEMM_MR+r] = a[r];
+            for( r = mr; r < HPL_DGEMM_MR; r++ ) AP[l*HPL_DGEMM_MR+r] =
+                                                 HPL_rzero;
+         }
+      }
+      else
+      {
+         for( r = 0; r < mr; r++ )
+         {
+            a = A + (size_t)(i+r) * LDA;
+            for( l = 0; l < K; l++ ) AP[l*HPL_DGEMM_MR+r] = a[l];
+         }
+         for( r = mr; r < HPL_DGEMM_MR; r++ )
+         {  for( l = 0; l < K; l++ ) AP[l*HPL_DGEMM_MR+r] = HPL_rzero; }
+      }
+   }
+}
+
+#ifdef STDC_HEADERS
+static void HPL_dgepackB
+(
+   const enum HPL_TRANS       TRANS,
+   const int                  K,
+   const int                  N,
+   const double               * B,
+   const int                  LDB,
+   double                     * BP
+)
+#else
+static void HPL_dgepackB( TRANS, K, N, B, LDB, BP )
+   const enum HPL_TRANS       TRANS;
+   const int                  K, LDB, N;
+   const double               * B;
+   double                     * BP;
+#endif
+{
+/*
+ * Pack the K x N matrix op(B) into column panels of HPL_DGEMM_NR columns,
+ * the entries of a row of each panel being contiguous. The last panel is
+ * padded with zeros.
+ */
+   const double               * b;
+   int                        j, l, nr, r;
+
+   for( j = 0; j < N; j += HPL_DGEMM_NR, BP += HPL_DGEMM_NR * K )
+   {
+      nr = Mmin( HPL_DGEMM_NR, N - j );
+      if( TRANS == HplNoTrans )
+      {
+         for( r = 0; r < nr; r++ )
+         {
+            b = B + (size_t)(j+r) * LDB;
+            for( l = 0; l < K; l++ ) BP[l*HPL_DGEMM_NR+r] = b[l];
+         }
+         for( r = nr; r < HPL_DGEMM_NR; r++ )
+         {  for( l = 0; l < K; l++ ) BP[l*HPL_DGEMM_NR+r] = HPL_rzero; }
+      }
+      else
+      {
+         for( l = 0; l < K; l++ )
+         {
+            b = B + j + (size_t)(l) * LDB;
+            for( r = 0;  r < nr;           r++ ) BP[l*HPL_DGEMM_NR+r] = b[r];
+            for( r = nr; r < HPL_DGEMM_NR; r++ ) BP[l*HPL_DGEMM_NR+r] =
+                                                 HPL_rzero;
+         }
+      }
+   }
+}
+
+#ifdef STDC_HEADERS
+static void HPL_dgemmK
+(
+   const int                  K,
+   const double               ALPHA,
+   const double               * AP,
+   const double               * BP,
+   double                     * C,
+   const int                  LDC,
+   const int                  MR,
+   const int                  NR
+)
+#else
+static void HPL_dgemmK( K, ALPHA, AP, BP, C, LDC, MR, NR )
+   const int                  K, LDC, MR, NR;
+   const double               ALPHA;
+   const double               * AP, * BP;
+   double                     * C;
+#endif
+{
+/*
+ * Micro-kernel: C(0:MR-1,0:NR-1) += ALPHA * AP * BP,  where AP and BP are
+ * packed panels of depth K.  The full HPL_DGEMM_MR x HPL_DGEMM_NR tile is
+ * accumulated in registers and only its leading MR x NR part is added to
+ * C.
+ */
+   double                     ab[HPL_DGEMM_MR*HPL_DGEMM_NR];
+   double                     * c;
+   int                        i, j, l;
+#if   defined( __AVX512F__ )
+   __m512d                    a0, a1, b, c00, c01, c10, c11, c20, c21,
+                              c30, c31, c40, c41, c50, c51;
+
+   c00 = c01 = c10 = c11 = c20 = c21 = _mm512_setzero_pd();
+   c30 = c31 = c40 = c41 = c50 = c51 = _mm512_setzero_pd();
+
+   for( l = 0; l < K; l++, AP += 16, BP += 6 )
+   {
+      a0 = _mm512_loadu_pd( AP ); a1 = _mm512_loadu_pd( AP + 8 );
+      b = _mm512_set1_pd( BP[0] );
+      c00 = _mm512_fmadd_pd( a0, b, c00 ); c01 = _mm512_fmadd_pd( a1, b, c01 );
+      b = _mm512_set1_pd( BP[1] );
+      c10 = _mm512_fmadd_pd( a0, b, c10 ); c11 = _mm512_fmadd_pd( a1, b, c11 );
+      b = _mm512_set1_pd( BP[2] );
+      c20 = _mm512_fmadd_pd( a0, b, c20 ); c21 = _mm512_fmadd_pd( a1, b, c21 );
+      b = _mm512_set1_pd( BP[3] );
+      c30 = _mm512_fmadd_pd( a0, b, c30 ); c31 = _mm512_fmadd_pd( a1, b, c31 );
+      b = _mm512_set1_pd( BP[4] );
+      c40 = _mm512_fmadd_pd( a0, b, c40 ); c41 = _mm512_fmadd_pd( a1, b, c41 );
+      b = _mm512_set1_pd( BP[5] );
+      c50 = _mm512_fmadd_pd( a0, b, c50 ); c51 = _mm512_fmadd_pd( a1, b, c51 );
+   }
+   _mm512_storeu_pd( ab+ 0, c00 ); _mm512_storeu_pd( ab+ 8, c01 );
+   _mm512_storeu_pd( ab+16, c10 ); _mm512_storeu_pd( ab+24, c11 );
+   _mm512_storeu_pd( ab+32, c20 ); _mm512_storeu_pd( ab+40, c21 );
+   _mm512_storeu_pd( ab+48, c30 ); _mm512_storeu_pd( ab+56, c31 );
+   _mm512_storeu_pd( ab+64, c40 ); _mm512_storeu_pd( ab+72, c41 );
+   _mm512_storeu_pd( ab+80, c50 ); _mm512_storeu_pd( ab+88, c51 );
+#elif defined( __AVX2__ ) && defined( __FMA__ )
+   __m256d                    a0, a1, b, c00, c01, c10, c11, c20, c21,
+                              c30, c31, c40, c41, c50, c51;
+
+   c00 = c01 = c10 = c11 = c20 = c21 = _mm256_setzero_pd();
+   c30 = c31 = c40 = c41 = c50 = c51 = _mm256_setzero_pd();
+
+   for( l = 0; l < K; l++, AP += 8, BP += 6 )
+   {
+      a0 = _mm256_loadu_pd( AP ); a1 = _mm256_loadu_pd( AP + 4 );
+      b = _mm256_broadcast_sd( BP     );
+      c00 = _mm256_fmadd_pd( a0, b, c00 ); c01 = _mm256_fmadd_pd( a1, b, c01 );
+      b = _mm256_broadcast_sd( BP + 1 );
+      c10 = _mm256_fmadd_pd( a0, b, c10 ); c11 = _mm256_fmadd_pd( a1, b, c11 );
+      b = _mm256_broadcast_sd( BP + 2 );
+      c20 = _mm256_fmadd_pd( a0, b, c20 ); c21 = _mm256_fmadd_pd( a1, b, c21 );
+      b = _mm256_broadcast_sd( BP + 3 );
+      c30 = _mm256_fmadd_pd( a0, b, c30 ); c31 = _mm256_fmadd_pd( a1, b, c31 );
+      b = _mm256_broadcast_sd( BP + 4 );
+      c40 = _mm256_fmadd_pd( a0, b, c40 ); c41 = _mm256_fmadd_pd( a1, b, c41 );
+      b = _mm256_broadcast_sd( BP + 5 );
+      c50 = _mm256_fmadd_pd( a0, b, c50 ); c51 = _mm256_fmadd_pd( a1, b, c51 );
+   }
+   _mm256_storeu_pd( ab+ 0, c00 ); _mm256_storeu_pd( ab+ 4, c01 );
+   _mm256_storeu_pd( ab+ 8, c10 ); _mm256_storeu_pd( ab+12, c11 );
+   _mm256_storeu_pd( ab+16, c20 ); _mm256_storeu_pd( ab+20, c21 );
+   _mm256_storeu_pd( ab+24, c30 ); _mm256_storeu_pd( ab+28, c31 );
+   _mm256_storeu_pd( ab+32, c40 ); _mm256_storeu_pd( ab+36, c41 );
+   _mm256_storeu_pd( ab+40, c50 ); _mm256_storeu_pd( ab+44, c51 );
+#else
+   register double            a0, a1, a2, a3, b;
+
+   for( i = 0; i < HPL_DGEMM_MR * HPL_DGEMM_NR; i++ ) ab[i] = HPL_rzero;
+
+   for( l = 0; l < K; l++, AP += 4, BP += 4 )
+   {
+      a0 = AP[0]; a1 = AP[1]; a2 = AP[2]; a3 = AP[3];
+      b = BP[0];
+      ab[ 0] += a0 * b; ab[ 1] += a1 * b; ab[ 2] += a2 * b; ab[ 3] += a3 * b;
+      b = BP[1];
+      ab[ 4] += a0 * b; ab[ 5] += a1 * b; ab[ 6] += a2 * b; ab[ 7] += a3 * b;
+      b = BP[2];
+      ab[ 8] += a0 * b; ab[ 9] += a1 * b; ab[10] += a2 * b; ab[11] += a3 * b;
+      b = BP[3];
+      ab[12] += a0 * b; ab[13] += a1 * b; ab[14] += a2 * b; ab[15] += a3 * b;
+   }
+#endif
+   for( j = 0; j < NR; j++ )
+   {
+      c = C + (size_t)(j) * LDC;
+      for( i = 0; i < MR; i++ ) c[i] += ALPHA * ab[i+j*HPL_DGEMM_MR];
+   }
+}
+
+#ifdef STDC_HEADERS
+static void HPL_dgemmP
+(
+   const enum HPL_TRANS       TRANSA,
+   const enum HPL_TRANS       TRANSB,
+   const int                  M,
+   const int                  N,
+   const int                  K,
+   const double               ALPHA,
+   const double               * A,
+   const int                  LDA,
+   const double               * B,
+   const int                  LDB,
+   double                     * C,
+   const int                  LDC,
+   const double               * AP
+)
+#else
+static void HPL_dgemmP( TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB,
+                        C, LDC, AP )
+   const enum HPL_TRANS       TRANSA, TRANSB;
+   const int                  K, LDA, LDB, LDC, M, N;
+   const double               ALPHA;
+   const double               * A, * B, * AP;
+   double                     * C;
+#endif
+{
+/*
+ * C := C + ALPHA * op( A ) * op( B ) with the packed engine.  The packing
+ * buffers are sized to the problem  and  allocated per call,  since this
+ * routine may be entered concurrently by several threads.  When AP is not
+ * NULL, it holds op( A ) already packed by HPL_dgepack and A is not read.
+ */
+   const double               * a, * b;
+   double                     * Ap = NULL, * Bp;
+   size_t                     mpad;
+   int                        ic, ir, jc, jr, kc, mc, nc, pc;
+
+   mc = Mmin( M, HPL_DGEMM_MC ); kc = Mmin( K, HPL_DGEMM_KC );
+   nc = Mmin( N, HPL_DGEMM_NC );
+   mc = ( ( mc + HPL_DGEMM_MR - 1 ) / HPL_DGEMM_MR ) * HPL_DGEMM_MR;
+   nc = ( ( nc + HPL_DGEMM_NR - 1 ) / HPL_DGEMM_NR ) * HPL_DGEMM_NR;
+   mpad = (size_t)( ( M + HPL_DGEMM_MR - 1 ) / HPL_DGEMM_MR ) * HPL_DGEMM_MR;
+
+   if( AP == NULL )
+      Ap = (double *)malloc( (size_t)(mc) * (size_t)(kc) * sizeof( double ) );
+   Bp = (double *)malloc( (size_t)(nc) * (size_t)(kc) * sizeof( double ) );
+   if( ( ( AP == NULL ) && ( Ap == NULL ) ) || ( Bp == NULL ) )
+   { HPL_abort( __LINE__, "HPL_dgemm", "Memory allocation failed" ); }
+
+   for( jc = 0; jc < N; jc += HPL_DGEMM_NC )
+   {
+      nc = Mmin( HPL_DGEMM_NC, N - jc );
+      for( pc = 0; pc < K; pc += HPL_DGEMM_KC )
+      {
+         kc = Mmin( HPL_DGEMM_KC, K - pc );
+         if( TRANSB == HplNoTrans ) b = B + pc + (size_t)(jc) * LDB;
+         else                       b = B + jc + (size_t)(pc) * LDB;
+         HPL_dgepackB( TRANSB, kc, nc, b, LDB, Bp );
+
+         for( ic = 0; ic < M; ic += HPL_DGEMM_MC )
+         {
+            mc = Mmin( HPL_DGEMM_MC, M - ic );
+            if( AP != NULL )
+            {
+               a = AP + (size_t)(pc) * mpad + (size_t)(ic) * kc;
+            }
+            else
+            {
+               if( TRANSA == HplNoTrans ) a = A + ic + (size_t)(pc) * LDA;
+               else                       a = A + pc + (size_t)(ic) * LDA;
+               HPL_dgepackA( TRANSA, mc, kc, a, LDA, Ap );
+               a = Ap;
+            }
+
+            for( jr = 0; jr < nc; jr += HPL_DGEMM_NR )
+            {
+               for( ir = 0; ir < mc; ir += HPL_DGEMM_MR )
+               {
+                  HPL_dgemmK( kc, ALPHA, a + (size_t)(ir) * kc,
+                              Bp + (size_t)(jr) * kc,
+                              C + ic + ir + (size_t)(jc + jr) * LDC, LDC,
+                              Mmin( HPL_DGEMM_MR, mc - ir ),
+                              Mmin( HPL_DGEMM_NR, nc - jr ) );
+               }
+            }
+         }
+      }
+   }
+   free( Bp ); if( Ap ) free( Ap );
+}
+
 #ifdef STDC_HEADERS
 static void HPL_dgemm0
 (
@@ -236,16 +581,30 @@ static void HPL_dgemm0( TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB,
    double                     * C;
 #endif
 {
+   double                     * c;
    int                        i, j;
 
    if( ( M == 0 ) || ( N == 0 ) ||
        ( ( ( ALPHA == HPL_rzero ) || ( K == 0 ) ) &&
          ( BETA == HPL_rone ) ) ) return;
 
-   if( ALPHA == HPL_rzero )
+   if( ( ALPHA == HPL_rzero ) || ( K == 0 ) ||
+       ( (double)(M) * (double)(N) * (double)(K) >= HPL_DGEMM_SMALL ) )
    {
+/*
+ * C := BETA * C, then accumulate with the packed engine if needed
+ */
       for( j = 0; j < N; j++ )
-      {  for( i = 0; i < M; i++ ) *(C+i+j*LDC) = HPL_rzero; }
+      {
+         c = C + (size_t)(j) * LDC;
+         if(      BETA == HPL_rzero )
+         { for( i = 0; i < M; i++ ) c[i]  = HPL_rzero; }
+         else if( BETA != HPL_rone  )
+         { for( i = 0; i < M; i++ ) c[i] *= BETA;      }
+      }
+      if( ( ALPHA != HPL_rzero ) && ( K != 0 ) )
+         HPL_dgemmP( TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, C,
+                     LDC, NULL );
       return;
    }
 
@@ -406,11 +765,22 @@ void HPL_dgemm
  *
  * ---------------------------------------------------------------------
  */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
 #ifdef HPL_CALL_CBLAS
    cblas_dgemm( ORDER, TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB,
                 BETA, C, LDC );
 #endif
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dgemm != NULL )
+   {
+      HPL_blas.dgemm( ORDER, TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B,
+                      LDB, BETA, C, LDC );
+   }
+   else
+#endif
    if( ORDER == HplColumnMajor )
    {
       HPL_dgemm0( TRANSA, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, BETA,
@@ -513,9 +883,286 @@ void HPL_dgemm
 #endif
    }
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DGEMM, Mmin( M, Mmin( N, K ) ),
+                  2.0 * (double)(M) * (double)(N) * (double)(K), t0 );
+#endif
 /*
  * End of HPL_dgemm
  */
 }
 
 #endif
+
+#ifdef STDC_HEADERS
+size_t HPL_dgepack_size
+(
+   const int                        M,
+   const int                        K
+)
+#else
+size_t HPL_dgepack_size( M, K )
+   const int                        K, M;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_dgepack_size returns the number of  double precision words needed
+ * by HPL_dgepack to store an m by k matrix in the  packed format of the
+ * built-in  HPL_dgemm.  Zero is returned  when pre-packing  is  not  a
+ * benefit,  i.e.,  when the matrix is empty,  or when HPL_dgemm is not
+ * the built-in kernel (another BLAS or a library selected at run time).
+ *
+ * Arguments
+ * =========
+ *
+ * M       (local input)                 const int
+ *         On entry,  M  specifies the number of rows of the matrix A.
+ *
+ * K       (local input)                 const int
+ *         On entry,  K  specifies the number of columns of the matrix A.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dgemm != NULL ) return( 0 );
+#endif
+   if( ( M <= 0 ) || ( K <= 0 ) ||
+       ( HPL_DGEMM_MC % HPL_DGEMM_MR != 0 ) ) return( 0 );
+   return( (size_t)( ( M + HPL_DGEMM_MR - 1 ) / HPL_DGEMM_MR ) *
+           (size_t)(HPL_DGEMM_MR) * (size_t)(K) );
+#else
+   (void) M; (void) K;
+   return( 0 );
+#endif
+/*
+ * End of HPL_dgepack_size
+ */
+}
+
+#ifdef STDC_HEADERS
+void HPL_dgepack
+(
+   const int                        M,
+   const int                        K,
+   const double *                   A,
+   const int                        LDA,
+   double *                         AP
+)
+#else
+void HPL_dgepack( M, K, A, LDA, AP )
+   const int                        K, LDA, M;
+   const double *                   A;
+   double *                         AP;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_dgepack packs the m by k column-major matrix A into AP,  so that
+ * A can be passed as the left operand of several HPL_dgemmpk calls and
+ * be packed only once.  AP must hold at least HPL_dgepack_size( M, K )
+ * words;  nothing is done when that size is zero.
+ *
+ * Arguments
+ * =========
+ *
+ * M       (local input)                 const int
+ *         On entry,  M  specifies the number of rows of the matrix A.
+ *
+ * K       (local input)                 const int
+ *         On entry,  K  specifies the number of columns of the matrix A.
+ *
+ * A       (local input)                 const double *
+ *         On entry,  A  is an array of dimension (LDA,K) containing the
+ *         matrix to be packed.
+ *
+ * LDA     (local input)                 const int
+ *         On entry, LDA specifies the leading dimension of the array A.
+ *         LDA must be at least max(1,M).
+ *
+ * AP      (local output)                double *
+ *         On exit, AP contains the packed copy of A.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+#ifdef HPL_USE_BUILTIN_BLAS
+/*
+ * .. Local Variables ..
+ */
+   size_t                     mpad;
+   int                        kc, pc;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( HPL_dgepack_size( M, K ) == 0 ) return;
+   mpad = (size_t)( ( M + HPL_DGEMM_MR - 1 ) / HPL_DGEMM_MR ) *
+          HPL_DGEMM_MR;
+/*
+ * Each block of HPL_DGEMM_KC columns is stored as HPL_dgemmP would pack
+ * it,  the row panels of all its HPL_DGEMM_MC row blocks following each
+ * other.
+ */
+   for( pc = 0; pc < K; pc += HPL_DGEMM_KC )
+   {
+      kc = Mmin( HPL_DGEMM_KC, K - pc );
+      HPL_dgepackA( HplNoTrans, M, kc, A + (size_t)(pc) * LDA, LDA,
+                    AP + (size_t)(pc) * mpad );
+   }
+#else
+   (void) M; (void) K; (void) A; (void) LDA; (void) AP;
+#endif
+/*
+ * End of HPL_dgepack
+ */
+}
+
+#ifdef STDC_HEADERS
+void HPL_dgemmpk
+(
+   const enum HPL_TRANS             TRANSB,
+   const int                        M,
+   const int                        N,
+   const int                        K,
+   const double                     ALPHA,
+   const double *                   AP,
+   const double *                   A,
+   const int                        LDA,
+   const double *                   B,
+   const int                        LDB,
+   const double                     BETA,
+   double *                         C,
+   const int                        LDC
+)
+#else
+void HPL_dgemmpk
+( TRANSB, M, N, K, ALPHA, AP, A, LDA, B, LDB, BETA, C, LDC )
+   const enum HPL_TRANS             TRANSB;
+   const int                        M;
+   const int                        N;
+   const int                        K;
+   const double                     ALPHA;
+   const double *                   AP;
+   const double *                   A;
+   const int                        LDA;
+   const double *                   B;
+   const int                        LDB;
+   const double                     BETA;
+   double *                         C;
+   const int                        LDC;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_dgemmpk computes the column-major product
+ *
+ *     C := alpha * A * op( B ) + beta * C,
+ *
+ * where the m by k matrix A may have been packed beforehand by a call to
+ * HPL_dgepack.  When AP is NULL,  this is HPL_dgemm with TRANSA  equal
+ * to HplNoTrans.  Otherwise  A  is  read from  AP  only,  and only  the
+ * right operand is packed by this call.
+ *
+ * Arguments
+ * =========
+ *
+ * TRANSB  (local input)                 const enum HPL_TRANS
+ *         On entry, TRANSB  specifies the form of  op(B)  to be used in
+ *         the matrix-matrix operation (see HPL_dgemm).
+ *
+ * M       (local input)                 const int
+ *         On entry,  M  specifies the number of rows of A and C.
+ *
+ * N       (local input)                 const int
+ *         On entry,  N  specifies the number of columns of op(B) and C.
+ *
+ * K       (local input)                 const int
+ *         On entry,  K  specifies the number of columns of A and of rows
+ *         of op(B).
+ *
+ * ALPHA   (local input)                 const double
+ *         On entry, ALPHA specifies the scalar alpha.
+ *
+ * AP      (local input)                 const double *
+ *         On entry,  AP  is  NULL  or  contains  the  output  of
+ *         HPL_dgepack( M, K, A, LDA, AP ).
+ *
+ * A       (local input)                 const double *
+ *         On entry,  A  is an array of dimension (LDA,K) containing the
+ *         matrix A. It is only referenced when AP is NULL.
+ *
+ * LDA     (local input)                 const int
+ *         On entry, LDA specifies the leading dimension of the array A.
+ *
+ * B       (local input)                 const double *
+ *         On entry,  B  contains the matrix B (see HPL_dgemm).
+ *
+ * LDB     (local input)                 const int
+ *         On entry, LDB specifies the leading dimension of the array B.
+ *
+ * BETA    (local input)                 const double
+ *         On entry, BETA specifies the scalar beta.
+ *
+ * C       (local input/output)          double *
+ *         On entry,  C  contains the m by n matrix C.  On exit,  C  is
+ *         overwritten by alpha * A * op( B ) + beta * C.
+ *
+ * LDC     (local input)                 const int
+ *         On entry, LDC specifies the leading dimension of the array C.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+#ifdef HPL_USE_BUILTIN_BLAS
+/*
+ * .. Local Variables ..
+ */
+#ifdef HPL_BLAS_STATS
+   double                     t0;
+#endif
+   double                     * c;
+   int                        i, j;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( AP == NULL )
+   {
+      HPL_dgemm( HplColumnMajor, HplNoTrans, TRANSB, M, N, K, ALPHA, A,
+                 LDA, B, LDB, BETA, C, LDC );
+      return;
+   }
+   if( ( M == 0 ) || ( N == 0 ) ||
+       ( ( ( ALPHA == HPL_rzero ) || ( K == 0 ) ) &&
+         ( BETA == HPL_rone ) ) ) return;
+#ifdef HPL_BLAS_STATS
+   t0 = HPL_timer_walltime();
+#endif
+   for( j = 0; j < N; j++ )
+   {
+      c = C + (size_t)(j) * LDC;
+      if(      BETA == HPL_rzero )
+      { for( i = 0; i < M; i++ ) c[i]  = HPL_rzero; }
+      else if( BETA != HPL_rone  )
+      { for( i = 0; i < M; i++ ) c[i] *= BETA;      }
+   }
+   if( ( ALPHA != HPL_rzero ) && ( K != 0 ) )
+      HPL_dgemmP( HplNoTrans, TRANSB, M, N, K, ALPHA, A, LDA, B, LDB, C,
+                  LDC, AP );
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DGEMM, Mmin( M, Mmin( N, K ) ),
+                  2.0 * (double)(M) * (double)(N) * (double)(K), t0 );
+#endif
+#else
+   (void) AP;
+   HPL_dgemm( HplColumnMajor, HplNoTrans, TRANSB, M, N, K, ALPHA, A, LDA,
+              B, LDB, BETA, C, LDC );
+#endif
+/*
+ * End of HPL_dgemmpk
+ */
+}
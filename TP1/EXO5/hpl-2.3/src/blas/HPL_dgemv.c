@@ -51,7 +51,7 @@
 
 #ifndef HPL_dgemv
 
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
 
 #ifdef STDC_HEADERS
 static void HPL_dgemv0
@@ -224,10 +224,21 @@ void HPL_dgemv
  *
  * ---------------------------------------------------------------------
  */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
 #ifdef HPL_CALL_CBLAS
    cblas_dgemv( ORDER, TRANS, M, N, ALPHA, A, LDA, X, INCX, BETA, Y, INCY );
 #endif
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dgemv != NULL )
+   {
+      HPL_blas.dgemv( ORDER, TRANS, M, N, ALPHA, A, LDA, X, INCX, BETA, Y,
+                      INCY );
+   }
+   else
+#endif
    if( ORDER == HplColumnMajor )
    {
       HPL_dgemv0( TRANS, M, N, ALPHA, A, LDA, X, INCX, BETA, Y, INCY );
@@ -318,6 +329,10 @@ void HPL_dgemv
    }
 
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DGEMV, Mmin( M, N ),
+                  2.0 * (double)(M) * (double)(N), t0 );
+#endif
 /*
  * End of HPL_dgemv
  */
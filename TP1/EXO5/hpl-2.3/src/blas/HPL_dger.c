@@ -51,6 +51,68 @@
 
 #ifndef HPL_dger
 
+#ifdef HPL_USE_BUILTIN_BLAS
+
+#ifdef STDC_HEADERS
+static void HPL_dger0
+(
+   const enum HPL_ORDER             ORDER,
+   const int                        M,
+   const int                        N,
+   const double                     ALPHA,
+   const double *                   X,
+   const int                        INCX,
+   double *                         Y,
+   const int                        INCY,
+   double *                         A,
+   const int                        LDA
+)
+#else
+static void HPL_dger0
+( ORDER, M, N, ALPHA, X, INCX, Y, INCY, A, LDA )
+   const enum HPL_ORDER             ORDER;
+   const int                        M;
+   const int                        N;
+   const double                     ALPHA;
+   const double *                   X;
+   const int                        INCX;
+   double *                         Y;
+   const int                        INCY;
+   double *                         A;
+   const int                        LDA;
+#endif
+{
+/*
+ * .. Local Variables ..
+ */
+   register double           t0;
+   int                       i, iaij, ix, iy, j, jaj, jx, jy;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( M == 0 ) || ( N == 0 ) || ( ALPHA == HPL_rzero ) ) return;
+ 
+   if( ORDER == HplColumnMajor )
+   {
+      for( j = 0, jaj = 0, jy = 0; j < N; j++, jaj += LDA, jy += INCY )
+      {
+         t0 = ALPHA * Y[jy];
+         for( i = 0, iaij = jaj, ix = 0; i < M; i++, iaij += 1, ix += INCX )
+         { A[iaij] += X[ix] * t0; }
+      }
+   }
+   else
+   {
+      for( j = 0, jaj = 0, jx = 0; j < M; j++, jaj += LDA, jx += INCX )
+      {
+         t0 = ALPHA * X[jx];
+         for( i = 0, iaij = jaj, iy = 0; i < N; i++, iaij += 1, iy += INCY )
+         { A[iaij] += Y[iy] * t0; }
+      }
+   }
+}
+#endif
+
 #ifdef STDC_HEADERS
 void HPL_dger
 (
@@ -141,33 +203,21 @@ void HPL_dger
  *
  * ---------------------------------------------------------------------
  */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
 #ifdef HPL_CALL_CBLAS
    cblas_dger( ORDER, M, N, ALPHA, X, INCX, Y, INCY, A, LDA );
 #endif
-#ifdef HPL_CALL_VSIPL
-   register double           t0;
-   int                       i, iaij, ix, iy, j, jaj, jx, jy;
-
-   if( ( M == 0 ) || ( N == 0 ) || ( ALPHA == HPL_rzero ) ) return;
- 
-   if( ORDER == HplColumnMajor )
-   {
-      for( j = 0, jaj = 0, jy = 0; j < N; j++, jaj += LDA, jy += INCY )
-      {
-         t0 = ALPHA * Y[jy];
-         for( i = 0, iaij = jaj, ix = 0; i < M; i++, iaij += 1, ix += INCX )
-         { A[iaij] += X[ix] * t0; }
-      }
-   }
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dger != NULL )
+      HPL_blas.dger( ORDER, M, N, ALPHA, X, INCX, Y, INCY, A, LDA );
    else
-   {
-      for( j = 0, jaj = 0, jx = 0; j < M; j++, jaj += LDA, jx += INCX )
-      {
-         t0 = ALPHA * X[jx];
-         for( i = 0, iaij = jaj, iy = 0; i < N; i++, iaij += 1, iy += INCY )
-         { A[iaij] += Y[iy] * t0; }
-      }
-   }
+      HPL_dger0( ORDER, M, N, ALPHA, X, INCX, Y, INCY, A, LDA );
+#else
+   HPL_dger0( ORDER, M, N, ALPHA, X, INCX, Y, INCY, A, LDA );
+#endif
 #endif
 #ifdef HPL_CALL_FBLAS
    double                    alpha = ALPHA;
@@ -187,6 +237,10 @@ void HPL_dger
    else
    {  F77dger( &F77N, &F77M, &alpha, Y, &F77incy, X, &F77incx, A, &F77lda ); }
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DGER, Mmin( M, N ),
+                  2.0 * (double)(M) * (double)(N), t0 );
+#endif
 /*
  * End of HPL_dger
  */
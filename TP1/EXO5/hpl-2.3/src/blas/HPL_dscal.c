@@ -51,8 +51,10 @@
 
 #ifndef HPL_dscal
 
+#ifdef HPL_USE_BUILTIN_BLAS
+
 #ifdef STDC_HEADERS
-void HPL_dscal
+static void HPL_dscal0
 (
    const int                        N,
    const double                     ALPHA,
@@ -60,7 +62,7 @@ void HPL_dscal
    const int                        INCX
 )
 #else
-void HPL_dscal
+static void HPL_dscal0
 ( N, ALPHA, X, INCX )
    const int                        N;
    const double                     ALPHA;
@@ -68,41 +70,9 @@ void HPL_dscal
    const int                        INCX;
 #endif
 {
-/* 
- * Purpose
- * =======
- *
- * HPL_dscal scales the vector x by alpha.
- * 
- *
- * Arguments
- * =========
- *
- * N       (local input)                 const int
- *         On entry, N specifies the length of the vector x. N  must  be
- *         at least zero.
- *
- * ALPHA   (local input)                 const double
- *         On entry, ALPHA specifies the scalar alpha.   When  ALPHA  is
- *         supplied as zero, then the entries of the incremented array X
- *         need not be set on input.
- *
- * X       (local input/output)          double *
- *         On entry,  X  is an incremented array of dimension  at  least
- *         ( 1 + ( n - 1 ) * abs( INCX ) )  that  contains the vector x.
- *         On exit, the entries of the incremented array  X  are  scaled
- *         by the scalar alpha.
- *
- * INCX    (local input)                 const int
- *         On entry, INCX specifies the increment for the elements of X.
- *         INCX must not be zero.
- *
- * ---------------------------------------------------------------------
- */ 
-#ifdef HPL_CALL_CBLAS
-   cblas_dscal( N, ALPHA, X, INCX );
-#endif
-#ifdef HPL_CALL_VSIPL
+/*
+ * .. Local Variables ..
+ */
    register double           x0, x1, x2, x3, x4, x5, x6, x7;
    register const double     alpha = ALPHA;
    const double              * StX;
@@ -112,7 +82,9 @@ void HPL_dscal
                              incX4 = 4 * INCX, incX5 = 5 * INCX,
                              incX6 = 6 * INCX, incX7 = 7 * INCX,
                              incX8 = 8 * INCX;
-
+/* ..
+ * .. Executable Statements ..
+ */
    if( ( N > 0 ) && ( alpha != HPL_rone ) )
    {
       if( alpha == HPL_rzero )
@@ -159,6 +131,72 @@ void HPL_dscal
          { x0 = (*X); x0 *= alpha; *X = x0; X += INCX; }
       }
    }
+}
+#endif
+
+#ifdef STDC_HEADERS
+void HPL_dscal
+(
+   const int                        N,
+   const double                     ALPHA,
+   double *                         X,
+   const int                        INCX
+)
+#else
+void HPL_dscal
+( N, ALPHA, X, INCX )
+   const int                        N;
+   const double                     ALPHA;
+   double *                         X;
+   const int                        INCX;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_dscal scales the vector x by alpha.
+ * 
+ *
+ * Arguments
+ * =========
+ *
+ * N       (local input)                 const int
+ *         On entry, N specifies the length of the vector x. N  must  be
+ *         at least zero.
+ *
+ * ALPHA   (local input)                 const double
+ *         On entry, ALPHA specifies the scalar alpha.   When  ALPHA  is
+ *         supplied as zero, then the entries of the incremented array X
+ *         need not be set on input.
+ *
+ * X       (local input/output)          double *
+ *         On entry,  X  is an incremented array of dimension  at  least
+ *         ( 1 + ( n - 1 ) * abs( INCX ) )  that  contains the vector x.
+ *         On exit, the entries of the incremented array  X  are  scaled
+ *         by the scalar alpha.
+ *
+ * INCX    (local input)                 const int
+ *         On entry, INCX specifies the increment for the elements of X.
+ *         INCX must not be zero.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
+#ifdef HPL_CALL_CBLAS
+   cblas_dscal( N, ALPHA, X, INCX );
+#endif
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dscal != NULL )
+      HPL_blas.dscal( N, ALPHA, X, INCX );
+   else
+      HPL_dscal0( N, ALPHA, X, INCX );
+#else
+   HPL_dscal0( N, ALPHA, X, INCX );
+#endif
 #endif
 #ifdef HPL_CALL_FBLAS
    double                    alpha = ALPHA;
@@ -171,6 +209,9 @@ void HPL_dscal
 
    F77dscal( &F77N, &alpha, X, &F77incx );
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DSCAL, N, (double)(N), t0 );
+#endif
 /*
  * End of HPL_dscal
  */
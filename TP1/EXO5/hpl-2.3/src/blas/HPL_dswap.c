@@ -109,7 +109,7 @@ void HPL_dswap
 #ifdef HPL_CALL_CBLAS
    cblas_dswap( N, X, INCX, Y, INCY );
 #endif
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
    register double           x0, x1, x2, x3, y0, y1, y2, y3;
    double                    * StX;
    register int              i;
@@ -51,7 +51,7 @@
 
 #ifndef HPL_dtrsm
 
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
 
 #ifdef STDC_HEADERS
 static void HPL_dtrsmLLNN
@@ -723,6 +723,121 @@ static void HPL_dtrsm0( SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA, B, LDB )
    }
 }
 
+/*
+ * Triangular systems  of order  larger  than  HPL_DTRSM_NB  are  solved
+ * recursively:  the  order  is halved,  the diagonal blocks are solved
+ * for  and  the off-diagonal block is applied  with the packed DGEMM en-
+ * gine, so that most of the flops run at matrix-multiply speed.
+ */
+#ifndef HPL_DTRSM_NB
+#define    HPL_DTRSM_NB            64
+#endif
+
+#ifdef STDC_HEADERS
+static void HPL_dtrsmB
+(
+   const enum HPL_SIDE        SIDE,
+   const enum HPL_UPLO        UPLO,
+   const enum HPL_TRANS       TRANS,
+   const enum HPL_DIAG        DIAG,
+   const int                  M,
+   const int                  N,
+   const double               ALPHA,
+   const double               * A,
+   const int                  LDA,
+   double                     * B,
+   const int                  LDB
+)
+#else
+static void HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA, B, LDB )
+   const enum HPL_SIDE        SIDE;
+   const enum HPL_UPLO        UPLO;
+   const enum HPL_TRANS       TRANS;
+   const enum HPL_DIAG        DIAG;
+   const int                  LDA, LDB, M, N;
+   const double               ALPHA;
+   const double               * A;
+   double                     * B;
+#endif
+{
+   const double               * A12, * A21, * A22;
+   int                        fwd, k, k1, k2;
+
+   k = ( SIDE == HplLeft ? M : N );
+
+   if( ( k <= HPL_DTRSM_NB ) || ( M == 0 ) || ( N == 0 ) ||
+       ( ALPHA == HPL_rzero ) )
+   {
+      HPL_dtrsm0( SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA, B, LDB );
+      return;
+   }
+/*
+ * op( A ) = [ op(A)11 op(A)12 ; op(A)21 op(A)22 ],  k1 being a multiple of
+ * HPL_DTRSM_NB.  op(A)12 (resp. op(A)21) is stored in A12 (resp. A21) when
+ * op( A ) = A, and in A21 (resp. A12) when op( A ) = A^T.
+ */
+   k1  = ( ( ( k >> 1 ) + HPL_DTRSM_NB - 1 ) / HPL_DTRSM_NB ) * HPL_DTRSM_NB;
+   k2  = k - k1;
+   A22 = A + k1 + (size_t)(k1) * LDA;
+   if( TRANS == HplNoTrans )
+   { A12 = A + (size_t)(k1) * LDA; A21 = A + k1; }
+   else
+   { A12 = A + k1; A21 = A + (size_t)(k1) * LDA; }
+/*
+ * Solve with the diagonal block met first  (forward  substitution when
+ * op( A ) is lower triangular on the left, or upper on the right), update
+ * the other block of rows (resp. columns) of B, and finish with the other
+ * diagonal block.
+ */
+   fwd = ( ( UPLO == HplLower ) == ( TRANS == HplNoTrans ) );
+   if( SIDE == HplRight ) fwd = !fwd;
+
+   if( SIDE == HplLeft )
+   {
+      if( fwd )
+      {
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, k1, N, ALPHA, A, LDA,
+                     B, LDB );
+         HPL_dgemm( HplColumnMajor, TRANS, HplNoTrans, k2, N, k1,
+                    -HPL_rone, A21, LDA, B, LDB, ALPHA, B+k1, LDB );
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, k2, N, HPL_rone, A22, LDA,
+                     B+k1, LDB );
+      }
+      else
+      {
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, k2, N, ALPHA, A22, LDA,
+                     B+k1, LDB );
+         HPL_dgemm( HplColumnMajor, TRANS, HplNoTrans, k1, N, k2,
+                    -HPL_rone, A12, LDA, B+k1, LDB, ALPHA, B, LDB );
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, k1, N, HPL_rone, A, LDA,
+                     B, LDB );
+      }
+   }
+   else
+   {
+      if( fwd )
+      {
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, M, k1, ALPHA, A, LDA,
+                     B, LDB );
+         HPL_dgemm( HplColumnMajor, HplNoTrans, TRANS, M, k2, k1,
+                    -HPL_rone, B, LDB, A12, LDA, ALPHA,
+                    B+(size_t)(k1)*LDB, LDB );
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, M, k2, HPL_rone, A22, LDA,
+                     B+(size_t)(k1)*LDB, LDB );
+      }
+      else
+      {
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, M, k2, ALPHA, A22, LDA,
+                     B+(size_t)(k1)*LDB, LDB );
+         HPL_dgemm( HplColumnMajor, HplNoTrans, TRANS, M, k1, k2,
+                    -HPL_rone, B+(size_t)(k1)*LDB, LDB, A21, LDA, ALPHA,
+                    B, LDB );
+         HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, M, k1, HPL_rone, A, LDA,
+                     B, LDB );
+      }
+   }
+}
+
 #endif
 
 #ifdef STDC_HEADERS
@@ -856,17 +971,28 @@ void HPL_dtrsm
  *
  * ---------------------------------------------------------------------
  */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
 #ifdef HPL_CALL_CBLAS
    cblas_dtrsm( ORDER, SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA, B, LDB );
 #endif
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dtrsm != NULL )
+   {
+      HPL_blas.dtrsm( ORDER, SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA,
+                      B, LDB );
+   }
+   else
+#endif
    if( ORDER == HplColumnMajor )
    {
-      HPL_dtrsm0( SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA, B, LDB );
+      HPL_dtrsmB( SIDE, UPLO, TRANS, DIAG, M, N, ALPHA, A, LDA, B, LDB );
    }
    else
    {
-      HPL_dtrsm0( ( SIDE == HplRight ? HplLeft  : HplRight ),
+      HPL_dtrsmB( ( SIDE == HplRight ? HplLeft  : HplRight ),
                   ( UPLO == HplLower ? HplUpper : HplLower ),
                   TRANS, DIAG, N, M, ALPHA, A, LDA, B, LDB );
    }
@@ -969,6 +1095,11 @@ void HPL_dtrsm
 #endif
    }
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DTRSM, Mmin( M, N ),
+                  ( SIDE == HplLeft ? (double)(M) : (double)(N) ) *
+                  (double)(M) * (double)(N), t0 );
+#endif
 /*
  * End of HPL_dtrsm
  */
@@ -51,7 +51,7 @@
 
 #ifndef HPL_dtrsv
 
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
 
 #ifdef STDC_HEADERS
 static void HPL_dtrsvLNN
@@ -437,10 +437,20 @@ void HPL_dtrsv
  *
  * ---------------------------------------------------------------------
  */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
+#endif
 #ifdef HPL_CALL_CBLAS
    cblas_dtrsv( ORDER, UPLO, TRANS, DIAG, N, A, LDA, X, INCX );
 #endif
-#ifdef HPL_CALL_VSIPL
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.dtrsv != NULL )
+   {
+      HPL_blas.dtrsv( ORDER, UPLO, TRANS, DIAG, N, A, LDA, X, INCX );
+   }
+   else
+#endif
    if( ORDER == HplColumnMajor )
    {
       HPL_dtrsv0( UPLO, TRANS, DIAG, N, A, LDA, X, INCX );
@@ -511,6 +521,9 @@ void HPL_dtrsv
    F77dtrsv( &fuplo, &ftran, &fdiag, &F77N, A, &F77lda, X, &F77incx );
 #endif
 
+#endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_DTRSV, N, (double)(N) * (double)(N), t0 );
 #endif
 /*
  * End of HPL_dtrsv
@@ -51,49 +51,26 @@
 
 #ifndef HPL_idamax
 
+#ifdef HPL_USE_BUILTIN_BLAS
+
 #ifdef STDC_HEADERS
-int HPL_idamax
+static int HPL_idamax0
 (
    const int                        N,
    const double *                   X,
    const int                        INCX
 )
 #else
-int HPL_idamax
+static int HPL_idamax0
 ( N, X, INCX )
    const int                        N;
    const double *                   X;
    const int                        INCX;
-#endif 
-{
-/* 
- * Purpose
- * =======
- *
- * HPL_idamax returns  the index in an n-vector  x  of the first element
- * having maximum absolute value.
- *
- * Arguments
- * =========
- *
- * N       (local input)                 const int
- *         On entry, N specifies the length of the vector x. N  must  be
- *         at least zero.
- *
- * X       (local input)                 const double *
- *         On entry,  X  is an incremented array of dimension  at  least
- *         ( 1 + ( n - 1 ) * abs( INCX ) )  that  contains the vector x.
- *
- * INCX    (local input)                 const int
- *         On entry, INCX specifies the increment for the elements of X.
- *         INCX must not be zero.
- *
- * ---------------------------------------------------------------------
- */ 
-#ifdef HPL_CALL_CBLAS
-   return( (int)(cblas_idamax( N, X, INCX )) );
 #endif
-#ifdef HPL_CALL_VSIPL
+{
+/*
+ * .. Local Variables ..
+ */
    register double           absxi, smax = HPL_rzero, x0, x1, x2, x3,
                              x4, x5, x6, x7;
    const double              * StX;
@@ -103,7 +80,9 @@ int HPL_idamax
                              incX4 = 4 * INCX, incX5 = 5 * INCX,
                              incX6 = 6 * INCX, incX7 = 7 * INCX,
                              incX8 = 8 * INCX;
-
+/* ..
+ * .. Executable Statements ..
+ */
    if( N > 0 )
    {
       if( ( nu = ( N >> 3 ) << 3 ) != 0 )
@@ -146,6 +125,50 @@ int HPL_idamax
       }
    }
    return( imax );
+}
+#endif
+
+#ifdef STDC_HEADERS
+int HPL_idamax
+(
+   const int                        N,
+   const double *                   X,
+   const int                        INCX
+)
+#else
+int HPL_idamax
+( N, X, INCX )
+   const int                        N;
+   const double *                   X;
+   const int                        INCX;
+#endif 
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_idamax returns  the index in an n-vector  x  of the first element
+ * having maximum absolute value.
+ *
+ * Arguments
+ * =========
+ *
+ * N       (local input)                 const int
+ *         On entry, N specifies the length of the vector x. N  must  be
+ *         at least zero.
+ *
+ * X       (local input)                 const double *
+ *         On entry,  X  is an incremented array of dimension  at  least
+ *         ( 1 + ( n - 1 ) * abs( INCX ) )  that  contains the vector x.
+ *
+ * INCX    (local input)                 const int
+ *         On entry, INCX specifies the increment for the elements of X.
+ *         INCX must not be zero.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+#ifdef HPL_BLAS_STATS
+   double                    t0 = HPL_timer_walltime();
 #endif
 #ifdef HPL_CALL_FBLAS
 #ifdef HPL_USE_F77_INTEGER_DEF
@@ -153,12 +176,30 @@ int HPL_idamax
 #else
 #define F77N                 N
 #define F77incx              INCX
+#endif
 #endif
    int                       imax = 0;
 
+#ifdef HPL_CALL_CBLAS
+   imax = (int)(cblas_idamax( N, X, INCX ));
+#endif
+#ifdef HPL_USE_BUILTIN_BLAS
+#ifdef HPL_CALL_DLBLAS
+   if( HPL_blas.idamax != NULL )
+      imax = (int)HPL_blas.idamax( N, X, INCX );
+   else
+      imax = HPL_idamax0( N, X, INCX );
+#else
+   imax = HPL_idamax0( N, X, INCX );
+#endif
+#endif
+#ifdef HPL_CALL_FBLAS
    if( N > 0 ) imax = F77idamax( &F77N, X, &F77incx ) - 1;
-   return( imax );
 #endif
+#ifdef HPL_BLAS_STATS
+   HPL_blas_stat( HPL_BLAS_IDAMAX, N, HPL_rzero, t0 );
+#endif
+   return( imax );
 /*
  * End of HPL_idamax
  */
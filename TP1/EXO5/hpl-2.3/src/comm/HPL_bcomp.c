@@ -0,0 +1,119 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_bcomp
+(
+   HPL_T_panel *                    PANEL
+)
+#else
+void HPL_bcomp
+( PANEL )
+   HPL_T_panel *                    PANEL;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_bcomp prepares the  broadcast  of the current panel  in single
+ * precision  in the process column owning it.  L2 is rounded to single
+ * precision in place,  so that this process updates  with the same L2
+ * as the others,  and  is packed  two entries per double  into  L2S,
+ * followed by L1, DPIV and DINFO in double precision.
+ *
+ * Arguments
+ * =========
+ *
+ * PANEL   (input/output)                HPL_T_panel *
+ *         On entry,  PANEL  points to the  current panel data structure
+ *         being broadcast.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   double                     * A;
+   float                      * L2s;
+   float                      s;
+   int                        i, j, jb, lda, m, nl1, nw;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( PANEL->grid->mycol != PANEL->pcol ) return;
+
+   jb = PANEL->jb; lda = PANEL->lda; nl1 = jb*jb + jb + 1;
+   if( PANEL->grid->myrow == PANEL->prow )
+   { A = Mptr( PANEL->A, jb, -jb, lda ); m = PANEL->mp - jb; }
+   else
+   { A = Mptr( PANEL->A,  0, -jb, lda ); m = PANEL->mp;      }
+   m = Mmax( m, 0 ); nw = ( m * jb + 1 ) / 2;
+
+   PANEL->L2S = (double *)malloc( (size_t)(nw + nl1) * sizeof( double ) );
+   if( PANEL->L2S == NULL )
+   { HPL_pabort( __LINE__, "HPL_bcomp", "Memory allocation failed" ); }
+
+   L2s = (float *)(PANEL->L2S);
+   for( j = 0; j < jb; j++ )
+   {
+      for( i = 0; i < m; i++ )
+      {
+         s = (float)( *Mptr( A, i, j, lda ) );
+         *Mptr( A, i, j, lda ) = (double)(s); L2s[i+j*m] = s;
+      }
+   }
+   (void) memcpy( (void *)(PANEL->L2S + nw), (const void *)(PANEL->L1),
+                  (size_t)(nl1) * sizeof( double ) );
+/*
+ * End of HPL_bcomp
+ */
+}
@@ -0,0 +1,108 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_bexpand
+(
+   HPL_T_panel *                    PANEL
+)
+#else
+void HPL_bexpand
+( PANEL )
+   HPL_T_panel *                    PANEL;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_bexpand  expands the panel received  in single precision  outside
+ * of the process column owning it:  L1, DPIV and DINFO are moved  to
+ * their place after L2 and L2 is converted back to double precision in
+ * place. The volume received and saved is accumulated in HPL_mxst.
+ *
+ * Arguments
+ * =========
+ *
+ * PANEL   (input/output)                HPL_T_panel *
+ *         On entry,  PANEL  points to the  current panel data structure
+ *         that has been broadcast.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   double                     * L2;
+   float                      * L2s;
+   int                        i, jb, jbm, m, nw;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( PANEL->grid->mycol == PANEL->pcol ) return;
+
+   jb = PANEL->jb; L2 = PANEL->L2;
+   m  = PANEL->mp - ( PANEL->grid->myrow == PANEL->prow ? jb : 0 );
+   m  = Mmax( m, 0 ); jbm = m * jb; nw = ( jbm + 1 ) / 2;
+
+   HPL_mxst.nbyte += (double)(PANEL->len) * (double)sizeof( double );
+   HPL_mxst.nsave += (double)(jbm - nw)   * (double)sizeof( double );
+   (void) memmove( (void *)(PANEL->L1), (const void *)(L2 + nw),
+                   (size_t)(jb * jb + jb + 1) * sizeof( double ) );
+/*
+ * L2 doubles in size, convert it from the last entry backwards
+ */
+   L2s = (float *)(L2);
+   for( i = jbm - 1; i >= 0; i-- ) L2[i] = (double)(L2s[i]);
+/*
+ * End of HPL_bexpand
+ */
+}
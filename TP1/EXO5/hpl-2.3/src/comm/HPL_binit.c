@@ -65,7 +65,8 @@ int HPL_binit
  * =======
  *
  * HPL_binit initializes  a  row  broadcast.  Successful  completion  is
- * indicated by the returned error code HPL_SUCCESS.
+ * indicated by the returned error code HPL_SUCCESS.  When L2 is broad-
+ * cast in single precision, the panel is first compressed by HPL_bcomp.
  *
  * Arguments
  * =========
@@ -85,6 +86,9 @@ int HPL_binit
  * .. Executable Statements ..
  */
    if( PANEL->grid->npcol <= 1 ) return( HPL_SUCCESS );
+#ifdef HPL_USE_MPI_DATATYPE
+   if( PANEL->algo->bprec == 1 ) HPL_bcomp( PANEL );
+#endif
 /*
  * Retrieve the selected virtual broadcast topology
  */
@@ -66,7 +66,8 @@ int HPL_bwait
  *
  * HPL_bwait HPL_bwait waits  for  the  row  broadcast  of  the current  panel  to
  * terminate.  Successful completion is indicated by the returned  error
- * code HPL_SUCCESS.
+ * code HPL_SUCCESS.  When L2 is broadcast in single precision, the pa-
+ * nel received is then expanded by HPL_bexpand.
  *
  * Arguments
  * =========
@@ -101,6 +102,9 @@ int HPL_bwait
       case HPL_BLONG   : ierr = HPL_bwait_blong( PANEL ); break;
       default          : ierr = HPL_SUCCESS;
    }
+#ifdef HPL_USE_MPI_DATATYPE
+   if( PANEL->algo->bprec == 1 ) HPL_bexpand( PANEL );
+#endif
  
    return( ierr );
 /*
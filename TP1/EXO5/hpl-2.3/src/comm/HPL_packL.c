@@ -99,13 +99,13 @@ int HPL_packL
  * .. Local Variables ..
  */
 #ifndef HPL_COPY_L
-   MPI_Datatype               * type = NULL;
-   void                       * * * bufs = NULL;
+   MPI_Datatype               cols = MPI_DATATYPE_NULL, type[4];
+   void                       * bufs[4];
    double                     * A;
-   int                        * blen = NULL;
-   MPI_Aint                   * disp = NULL;
+   MPI_Aint                   disp[4];
+   int                        blen[4];
    int                        curr, i, i1, ibuf, ierr=MPI_SUCCESS, j1,
-                              jb, jbm, jbp1, lda, len, m, m1, nbufs;
+                              jb, jbm, lda, len, m, m1, nbufs, ncol;
 #else
    int                        ierr;
 #endif
@@ -114,10 +114,13 @@ int HPL_packL
  */
 #ifdef HPL_COPY_L
 /*
- * Panel + L1 + DPIV  have been copied into a contiguous buffer - Create
- * and commit a contiguous data type
+ * Panel + L1 + DPIV  have been copied into a contiguous buffer,  L2S
+ * in single precision - Create and commit a contiguous data type
  */
-   PANEL->buffers[IBUF] = (void *)(PANEL->L2 + INDEX);
+   if( PANEL->L2S != NULL )
+      PANEL->buffers[IBUF] = (void *)(PANEL->L2S + INDEX);
+   else
+      PANEL->buffers[IBUF] = (void *)(PANEL->L2  + INDEX);
    PANEL->counts [IBUF] = 1;
 
    ierr =      MPI_Type_contiguous( LEN, MPI_DOUBLE, &PANEL->dtypes[IBUF] );
@@ -127,112 +130,95 @@ int HPL_packL
    return( ierr );
 #else
 /*
- * Panel is not contiguous (because of LDA and also L1 + DPIV) -  Create
- * and commit a struct data type
+ * Outside of the current process column, L2 (of leading dimension m), L1,
+ * DPIV and DINFO are contiguous in the panel workspace,  and so is  any
+ * part of the buffer: create and commit a contiguous data type.  So is
+ * the single precision panel L2S in the current process column.
  */
-   jbp1 = ( jb = PANEL->jb ) + 1;
+   jb = PANEL->jb;
+   m  = PANEL->mp; curr = (int)( PANEL->grid->myrow == PANEL->prow );
+   if( curr != 0 ) m -= jb;
+   m  = Mmax( m, 0 ); jbm = jb * m;
+
+   if( ( PANEL->grid->mycol != PANEL->pcol ) || ( PANEL->L2S != NULL ) )
+   {
+      PANEL->buffers[IBUF] = (void *)( ( PANEL->L2S != NULL ?
+                                         PANEL->L2S : PANEL->L2 ) + INDEX );
+      PANEL->counts [IBUF] = 1;
+
+      ierr =      MPI_Type_contiguous( LEN, MPI_DOUBLE,
+                                       &PANEL->dtypes[IBUF] );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_commit( &PANEL->dtypes[IBUF] );
+      return( ierr );
+   }
 /*
- * Temporaries to create the type struct.
+ * In the current process column,  L2 is read in place from A.  The part
+ * of the buffer to be sent is described by at most four blocks:  a par-
+ * tial first column of L2,  a vector of full columns,  a partial last
+ * column, and the head of the contiguous L1, DPIV, DINFO array.  Those
+ * are assembled without allocating any temporary.
  */
-   bufs = (void     * * *)malloc( jbp1 * sizeof( void * *     ) );
-   blen = (int          *)malloc( jbp1 * sizeof( int          ) );
-   disp = (MPI_Aint     *)malloc( jbp1 * sizeof( MPI_Aint     ) );
-   type = (MPI_Datatype *)malloc( jbp1 * sizeof( MPI_Datatype ) );
- 
-   if( ( bufs != NULL ) && ( blen != NULL ) &&
-       ( disp != NULL ) && ( type != NULL ) )
+   len = LEN; ibuf = INDEX; nbufs = 0; bufs[0] = (void *)(PANEL->L1);
+
+   if( ( m > 0 ) && ( ibuf < jbm ) )
    {
-      m = PANEL->mp; curr = (int)( PANEL->grid->myrow == PANEL->prow );
-      if( curr != 0 ) m -= jb;
- 
-      len = LEN; ibuf = INDEX; nbufs = 0; jbm = jb * m;
- 
-      if( ( m > 0 ) && ( ibuf < jbm ) )
+      lda = PANEL->lda;
+      if( curr != 0 ) { A = Mptr( PANEL->A, jb, -jb, lda ); }
+      else            { A = Mptr( PANEL->A,  0, -jb, lda ); }
+
+      i1 = ibuf - ( j1 = ibuf / m ) * m;
+      if( i1 > 0 )                               /* partial 1st column */
       {
-/*
- * Retrieve proper pointers depending on process row and column
- */
-         if( PANEL->grid->mycol == PANEL->pcol )
-         {
-            lda = PANEL->lda;
-            if( curr != 0 ) { A = Mptr( PANEL->A, jb, -jb, lda ); }
-            else            { A = Mptr( PANEL->A,  0, -jb, lda ); }
-         }
-         else { lda = PANEL->ldl2; A = PANEL->L2; }
-/*
- * Pack the first (partial) column of L
- */
-         m1 = m - ( i1 = ibuf - ( j1 = ibuf / m ) * m );
-         m1 = Mmin( len, m1 );
- 
+         m1 = Mmin( len, m - i1 );
          bufs[nbufs] = (void *)(Mptr( A, i1, j1, lda ));
-         type[nbufs] = MPI_DOUBLE;
-         blen[nbufs] = m1;
-         if( ierr == MPI_SUCCESS )
-            ierr =   MPI_Get_address( bufs[nbufs], &disp[nbufs] );
- 
+         type[nbufs] = MPI_DOUBLE; blen[nbufs] = m1;
          nbufs++; len -= m1; j1++; ibuf += m1;
-/*
- * Pack the remaining columns of L
- */
-         while( ( len > 0 ) && ( j1 < jb ) )
-         {
-            m1 = Mmin( len, m );
- 
-            bufs[nbufs] = (void*)(Mptr( A, 0, j1, lda ));
-            type[nbufs] = MPI_DOUBLE;
-            blen[nbufs] = m1;
-            if( ierr == MPI_SUCCESS )
-               ierr =   MPI_Get_address( bufs[nbufs], &disp[nbufs] );
- 
-            nbufs++; len -= m1; j1++; ibuf += m1;
-         }
       }
-/*
- * Pack L1, DPIV, DINFO
- */
-      if( len > 0 )
-      {                                            /* L1, DPIV, DINFO */
-         bufs[nbufs] = (void *)(PANEL->L1 + ibuf - jbm);
-         type[nbufs] = MPI_DOUBLE;
-         blen[nbufs] = len;
+      ncol = Mmin( len / m, jb - j1 );
+      if( ncol > 0 )                                  /* full columns */
+      {
          if( ierr == MPI_SUCCESS )
-            ierr =   MPI_Get_address( bufs[nbufs], &disp[nbufs] );
-         nbufs++;
+            ierr =   MPI_Type_vector( ncol, m, lda, MPI_DOUBLE, &cols );
+         bufs[nbufs] = (void *)(Mptr( A, 0, j1, lda ));
+         type[nbufs] = cols; blen[nbufs] = 1;
+         nbufs++; len -= ncol * m; j1 += ncol; ibuf += ncol * m;
       }
- 
-      for( i = 1; i < nbufs; i++ ) disp[i] -= disp[0]; disp[0] = 0;
- 
-      PANEL->buffers[IBUF] = (void *)(bufs[0]); PANEL->counts [IBUF] = 1;
-/*
- * construct the struct type 
- */
-      if( ierr == MPI_SUCCESS )
-         ierr =   MPI_Type_create_struct( nbufs, blen, disp, type,
-                                   &PANEL->dtypes[IBUF] );
-/*
- * release temporaries
- */
-      if( bufs ) free( bufs );
-      if( blen ) free( blen );
-      if( disp ) free( disp );
-      if( type ) free( type );
-/*
- * commit the type 
- */
-      if( ierr == MPI_SUCCESS )
-         ierr =   MPI_Type_commit( &PANEL->dtypes[IBUF] );
+      if( ( len > 0 ) && ( j1 < jb ) )         /* partial last column */
+      {
+         m1 = Mmin( len, m );
+         bufs[nbufs] = (void *)(Mptr( A, 0, j1, lda ));
+         type[nbufs] = MPI_DOUBLE; blen[nbufs] = m1;
+         nbufs++; len -= m1; ibuf += m1;
+      }
+   }
 
-      return( ierr );
+   if( len > 0 )                                   /* L1, DPIV, DINFO */
+   {
+      bufs[nbufs] = (void *)(PANEL->L1 + ibuf - jbm);
+      type[nbufs] = MPI_DOUBLE; blen[nbufs] = len;
+      nbufs++;
    }
-   else
+
+   for( i = 0; i < nbufs; i++ )
    {
-/*
- * Memory allocation failed -> abort
- */
-      HPL_pabort( __LINE__, "HPL_packL", "Memory allocation failed" );
-      return( MPI_SUCCESS );    /* never executed (hopefully ...) */
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Get_address( bufs[i], &disp[i] );
    }
+   for( i = 1; i < nbufs; i++ ) disp[i] -= disp[0];
+   disp[0] = 0;
+
+   PANEL->buffers[IBUF] = (void *)(bufs[0]); PANEL->counts[IBUF] = 1;
+
+   if( ierr == MPI_SUCCESS )
+      ierr =   MPI_Type_create_struct( nbufs, blen, disp, type,
+                                       &PANEL->dtypes[IBUF] );
+   if( ierr == MPI_SUCCESS )
+      ierr =   MPI_Type_commit( &PANEL->dtypes[IBUF] );
+   if( ( ierr == MPI_SUCCESS ) && ( cols != MPI_DATATYPE_NULL ) )
+      ierr =   MPI_Type_free( &cols );
+
+   return( ierr );
 #endif
 #else
           /* HPL_USE_MPI_DATATYPE not defined - Oops, there is a bug
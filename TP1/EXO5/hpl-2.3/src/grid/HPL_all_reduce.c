@@ -73,7 +73,10 @@ int HPL_all_reduce
  * =======
  *
  * HPL_all_reduce performs   a   global   reduce  operation  across  all
- * processes of a group leaving the results on all processes.
+ * processes of a group leaving the results on all processes.  With the
+ * HPL_COLL_MPI backend and when OP is one of HPL_max, HPL_min and HPL_-
+ * sum,  this is a single MPI_Allreduce,  otherwise a reduce to the pro-
+ * cess of rank 0 followed by a broadcast.
  *
  * Arguments
  * =========
@@ -105,6 +108,13 @@ int HPL_all_reduce
 /* ..
  * .. Executable Statements ..
  */
+   if( ( HPL_coll == HPL_COLL_MPI ) && ( HPL_2_MPI_OP( OP ) != MPI_OP_NULL ) )
+   {
+      if( COUNT <= 0 ) return( MPI_SUCCESS );
+      return( MPI_Allreduce( MPI_IN_PLACE, BUFFER, COUNT,
+                             HPL_2_MPI_TYPE( DTYPE ), HPL_2_MPI_OP( OP ),
+                             COMM ) );
+   }
    hplerr = HPL_reduce(   BUFFER, COUNT, DTYPE, OP, 0, COMM );
    if( hplerr != MPI_SUCCESS ) return( hplerr );
    return( HPL_broadcast( BUFFER, COUNT, DTYPE,     0, COMM ) );
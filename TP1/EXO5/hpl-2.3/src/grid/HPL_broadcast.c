@@ -48,6 +48,11 @@
  * Include files
  */
 #include "hpl.h"
+/*
+ * The backend of HPL_broadcast, HPL_reduce and HPL_all_reduce,  the HPL
+ * trees until the driver selects another one
+ */
+HPL_T_COLL                          HPL_coll = HPL_COLL_TREE;
 
 #ifdef STDC_HEADERS
 int HPL_broadcast
@@ -73,7 +78,9 @@ int HPL_broadcast
  * =======
  *
  * HPL_broadcast broadcasts  a message from the process with rank ROOT to
- * all processes in the group.
+ * all processes in the group.  With the  HPL_COLL_MPI backend,  this is
+ * MPI_Bcast, otherwise a binomial tree of blocking point to point mes-
+ * sages.
  *
  * Arguments
  * =========
@@ -109,6 +116,9 @@ int HPL_broadcast
  * .. Executable Statements ..
  */
    if( COUNT <= 0 ) return( MPI_SUCCESS );
+   if( HPL_coll == HPL_COLL_MPI )
+      return( MPI_Bcast( BUFFER, COUNT, HPL_2_MPI_TYPE( DTYPE ), ROOT,
+                         COMM ) );
    mpierr = MPI_Comm_size( COMM, &size ); if( size <= 1 ) return( mpierr );
    mpierr = MPI_Comm_rank( COMM, &rank );
 
@@ -94,6 +94,8 @@ int HPL_grid_exit
       if( mpierr != MPI_SUCCESS ) hplerr = mpierr;
    }
 
+   (void) HPL_grid_wght( GRID, NULL );
+
    GRID->order   = HPL_COLUMN_MAJOR;
 
    GRID->iam     = GRID->myrow    = GRID->mycol     = -1;
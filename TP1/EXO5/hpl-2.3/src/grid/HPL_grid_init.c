@@ -137,6 +137,11 @@ int HPL_grid_init
    }
    GRID->iam   = rank;  GRID->myrow = myrow; GRID->mycol  = mycol;
    GRID->nprow = NPROW; GRID->npcol = NPCOL; GRID->nprocs = nprocs;
+/*
+ * The columns are block-cyclic until HPL_grid_wght weights them
+ */
+   GRID->wcyc = GRID->ncyc = 0;
+   GRID->cwgt = GRID->coff = GRID->cmap = GRID->cloc = GRID->cblk = NULL;
 /*
  * row_ip2   : largest power of two <= nprow;
  * row_hdim  : row_ip2 procs hypercube dim;
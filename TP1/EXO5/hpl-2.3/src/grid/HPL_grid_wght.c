@@ -0,0 +1,166 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+int HPL_grid_wght
+(
+   HPL_T_grid *                     GRID,
+   const int *                      WGHT
+)
+#else
+int HPL_grid_wght
+( GRID, WGHT )
+   HPL_T_grid *                     GRID;
+   const int *                      WGHT;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_grid_wght  weights  the  distribution  of the columns  over  the
+ * process columns of the grid: a cycle of wcyc blocks is dealt out so
+ * that process column q owns WGHT[q] of them, and every further cycle
+ * repeats the same pattern.  The blocks of a process column are stored
+ * in increasing global order,  as in the block-cyclic distribution.  In
+ * a cycle, the k-th block of process column q is placed at (2k+1) / (2
+ * WGHT[q]) of the cycle,  which interleaves the process columns as much
+ * as the weights allow,  and gives back  the block-cyclic order for
+ * equal weights.  The  weights  are divided by their greatest common
+ * divisor.  The  tables  are  read  by  HPL_numrocW,  HPL_indxg2pW,
+ * HPL_indxg2lW  and  HPL_indxl2gW  when  GRID->ncyc  is  non-zero.  The
+ * function returns the length of the cycle, 0 when the columns remain
+ * block-cyclic.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input/output)          HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information. On exit, the tables of the weighted
+ *         distribution are set, and any previous ones released.
+ *
+ * WGHT    (global input)                const int *
+ *         On entry,  WGHT  is an array of dimension  npcol  holding the
+ *         positive weight of every process column, or NULL,  equal or
+ *         non-positive weights  for  the block-cyclic  distribution.  It
+ *         must be the same in all the processes of the grid.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   int                        * buf, * next;
+   int                        b, g, k, npcol, q, r, s, t;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( GRID->cwgt != NULL ) free( GRID->cwgt );
+   GRID->wcyc = GRID->ncyc = 0;
+   GRID->cwgt = GRID->coff = GRID->cmap = GRID->cloc = GRID->cblk = NULL;
+
+   if( ( WGHT == NULL ) || ( ( npcol = GRID->npcol ) <= 1 ) ) return( 0 );
+/*
+ * Greatest common divisor of the weights
+ */
+   for( q = 0, g = 0; q < npcol; q++ )
+   {
+      if( WGHT[q] <= 0 ) return( 0 );
+      r = WGHT[q]; s = g;
+      while( s != 0 ) { t = r % s; r = s; s = t; }
+      g = r;
+   }
+   for( q = 0, s = 0, k = 0; q < npcol; q++ )
+   { s += WGHT[q] / g; if( WGHT[q] != WGHT[0] ) k = 1; }
+   if( k == 0 ) return( 0 );
+
+   buf  = (int *)malloc( (size_t)(2 * npcol + 3 * s) * sizeof( int ) );
+   next = (int *)malloc( (size_t)(npcol) * sizeof( int ) );
+   if( ( buf == NULL ) || ( next == NULL ) )
+   {
+      if( buf  ) free( buf  );
+      if( next ) free( next );
+      return( 0 );
+   }
+   GRID->cwgt = buf;              GRID->coff = buf + npcol;
+   GRID->cmap = buf + 2 * npcol;  GRID->cloc = GRID->cmap + s;
+   GRID->cblk = GRID->cloc + s;
+
+   for( q = 0, k = 0; q < npcol; q++ )
+   {
+      GRID->cwgt[q] = WGHT[q] / g; GRID->coff[q] = k;
+      k += GRID->cwgt[q]; next[q] = 0;
+   }
+/*
+ * Deal  out  the blocks of the cycle: the next one goes to the process
+ * column whose next block has the smallest position (2k+1)/(2 WGHT[q])
+ */
+   for( b = 0; b < s; b++ )
+   {
+      for( q = 0, r = -1; q < npcol; q++ )
+      {
+         if( next[q] >= GRID->cwgt[q] ) continue;
+         if( ( r < 0 ) ||
+             ( (long)(2 * next[q] + 1) * (long)(GRID->cwgt[r]) <
+               (long)(2 * next[r] + 1) * (long)(GRID->cwgt[q]) ) ) r = q;
+      }
+      GRID->cmap[b] = r; GRID->cloc[b] = next[r];
+      GRID->cblk[GRID->coff[r] + next[r]] = b; next[r]++;
+   }
+   free( next );
+
+   GRID->wcyc = GRID->ncyc = s;
+   return( s );
+/*
+ * End of HPL_grid_wght
+ */
+}
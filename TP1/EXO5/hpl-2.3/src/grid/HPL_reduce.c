@@ -77,6 +77,9 @@ int HPL_reduce
  * HPL_reduce performs a global reduce operation across all processes of
  * a group.  Note that the input buffer is  used as workarray and in all
  * processes but the accumulating process corrupting the original data.
+ * With the HPL_COLL_MPI backend and when OP is one of HPL_max, HPL_min
+ * and HPL_sum, this is MPI_Reduce with the matching built-in operation,
+ * otherwise a binomial tree of blocking point to point messages.
  *
  * Arguments
  * =========
@@ -120,6 +123,16 @@ int HPL_reduce
    mpierr = MPI_Comm_size( COMM, &size );
    if( size  == 1 ) return( MPI_SUCCESS );
    mpierr = MPI_Comm_rank( COMM, &rank );
+
+   if( ( HPL_coll == HPL_COLL_MPI ) && ( HPL_2_MPI_OP( OP ) != MPI_OP_NULL ) )
+   {
+      if( rank == ROOT )
+         return( MPI_Reduce( MPI_IN_PLACE, BUFFER, COUNT,
+                             HPL_2_MPI_TYPE( DTYPE ), HPL_2_MPI_OP( OP ),
+                             ROOT, COMM ) );
+      return( MPI_Reduce( BUFFER, NULL, COUNT, HPL_2_MPI_TYPE( DTYPE ),
+                          HPL_2_MPI_OP( OP ), ROOT, COMM ) );
+   }
    i = size - 1; while( i > 1 ) { i >>= 1; d++; }
 
    if( DTYPE == HPL_INT )
@@ -96,6 +96,10 @@ int HPL_pdpanel_free
 
    if( PANEL->WORK  ) free( PANEL->WORK  );
    if( PANEL->IWORK ) free( PANEL->IWORK );
+   if( PANEL->IPTAB ) free( PANEL->IPTAB );
+   if( PANEL->L2P   ) free( PANEL->L2P   );
+   if( PANEL->L2S   ) free( PANEL->L2S   );
+   PANEL->L2P = NULL; PANEL->L2S = NULL; PANEL->IPTAB = NULL;
 
    return( MPI_SUCCESS );
 /*
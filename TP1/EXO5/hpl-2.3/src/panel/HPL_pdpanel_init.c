@@ -154,8 +154,13 @@ void HPL_pdpanel_init
 
    HPL_infog2l( IA, JA, nb, nb, nb, nb, 0, 0, myrow, mycol,
                 nprow, npcol, &ii, &jj, &icurrow, &icurcol );
+   if( GRID->ncyc > 0 )
+   {                                   /* weighted column distribution */
+      jj      = HPL_numrocW( JA, 0, nb, mycol, GRID );
+      icurcol = HPL_indxg2pW( JA, nb, GRID );
+   }
    mp = HPL_numrocI( M, IA, nb, nb, myrow, 0, nprow );
-   nq = HPL_numrocI( N, JA, nb, nb, mycol, 0, npcol );
+   nq = HPL_numrocW( N, JA, nb, mycol, GRID );
                                          /* ptr to trailing part of A */
    PANEL->A       = Mptr( (double *)(A->A), ii, jj, A->ld );
 /*
@@ -163,7 +168,8 @@ void HPL_pdpanel_init
  */
    PANEL->WORK    = NULL; PANEL->L2      = NULL; PANEL->L1      = NULL;
    PANEL->DPIV    = NULL; PANEL->DINFO   = NULL; PANEL->U       = NULL;
-   PANEL->IWORK   = NULL;
+   PANEL->IWORK   = NULL; PANEL->L2P     = NULL; PANEL->L2S     = NULL;
+   PANEL->IPTAB   = NULL;
 /*
  * Local lengths, indexes process coordinates
  */
@@ -272,6 +278,13 @@ void HPL_pdpanel_init
       PANEL->DPIV  = PANEL->L1   + JB * JB;
       PANEL->DINFO = PANEL->DPIV + JB;     *(PANEL->DINFO) = 0.0;
       PANEL->U     = ( nprow > 1 ? PANEL->DINFO + 1 : NULL );
+/*
+ * When L2 is broadcast in single precision,  two entries of L2 travel
+ * in each double of the buffer, that is expanded by HPL_bexpand.
+ */
+#ifdef HPL_USE_MPI_DATATYPE
+      if( ALGO->bprec == 1 ) PANEL->len = ( ml2 * JB + 1 ) / 2 + itmp1;
+#endif
    }
 #ifdef HPL_CALL_VSIPL
    PANEL->Ablock  = A->block;
@@ -316,10 +329,10 @@ void HPL_pdpanel_init
  *       ipmap    is of size at most NPROW  +
  *       ipmapm1  is of size at most NPROW  +
  *       permU    is of size at most JB     +
- *       iwork    is of size at most MAX( 2*JB, NPROW+1 ).
+ *       iwork    is of size at most MAX( 2*JB, 4*NPROW ).
  *
- * that is  3 + 8*JB + MAX(2*NPROW, 3*NPROW+1+JB+MAX(2*JB,NPROW+1))
- *       =  4 + 9*JB + 3*NPROW + MAX( 2*JB, NPROW+1 ).
+ * that is  3 + 8*JB + MAX(2*NPROW, 3*NPROW+1+JB+MAX(2*JB,4*NPROW))
+ *       =  4 + 9*JB + 3*NPROW + MAX( 2*JB, 4*NPROW ).
  *
  * We use the fist entry of this to work array  to indicate  whether the
  * the  local  index arrays have already been computed,  and if yes,  by
@@ -332,7 +345,7 @@ void HPL_pdpanel_init
    if( nprow == 1 ) { lwork = JB; }
    else             
    {
-      itmp1 = (JB << 1); lwork = nprow + 1; itmp1 = Mmax( itmp1, lwork );
+      itmp1 = (JB << 1); lwork = nprow << 2; itmp1 = Mmax( itmp1, lwork );
       lwork = 4 + (9 * JB) + (3 * nprow) + itmp1;
    }
 
@@ -342,6 +355,22 @@ void HPL_pdpanel_init
    { HPL_pabort( __LINE__, "HPL_pdpanel_init", "Memory allocation failed" ); }
                        /* Initialize the first entry of the workarray */
    *(PANEL->IWORK) = -1;
+/*
+ * When nprow > 1, HPL_pipid also tabulates for every pair of IPID  the
+ * owner and local index of its source and destination rows,  the final
+ * position in U of a row swapped away,  and the pivots converted to int
+ * (5 * 2*JB + JB entries),  using a hash table of 2 * H  entries,  with
+ * H the smallest power of two not less than 4 * JB.
+ */
+   if( nprow > 1 )
+   {
+      for( itmp1 = 1; itmp1 < ( JB << 2 ); itmp1 <<= 1 );
+      lwork = 11 * JB + ( itmp1 << 1 );
+      PANEL->IPTAB = (int *)malloc( (size_t)(lwork) * sizeof( int ) );
+      if( PANEL->IPTAB == NULL )
+         HPL_pabort( __LINE__, "HPL_pdpanel_init",
+                     "Memory allocation failed" );
+   }
 /*
  * End of HPL_pdpanel_init
  */
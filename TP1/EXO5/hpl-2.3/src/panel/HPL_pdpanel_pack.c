@@ -0,0 +1,107 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdpanel_pack
+(
+   HPL_T_panel *                    PANEL
+)
+#else
+void HPL_pdpanel_pack
+( PANEL )
+   HPL_T_panel *                    PANEL;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdpanel_pack  packs  the  local part of L2,  once per panel,  into
+ * the format of the  built-in HPL_dgemm,  so that the update  does  not
+ * repack L2 for every block of columns it processes.  On exit,  L2P  is
+ * left NULL when packing is not supported  (see HPL_dgepack_size),  or
+ * when the workspace could not be allocated;  the update then calls the
+ * regular HPL_dgemm.  This function must be called after the panel has
+ * been received and before any update using it is started.
+ *
+ * Arguments
+ * =========
+ *
+ * PANEL   (local input/output)          HPL_T_panel *
+ *         On entry,  PANEL  points to the data structure containing the
+ *         panel information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   size_t                     lpk;
+   int                        jb, mp;
+/* ..
+ * .. Executable Statements ..
+ */
+#ifdef HPL_CALL_VSIPL
+   return;                     /* the VSIPL update does not use L2P */
+#endif
+   if( PANEL->L2P != NULL ) return;
+
+   jb = PANEL->jb;
+   mp = PANEL->mp - ( PANEL->grid->myrow == PANEL->prow ? jb : 0 );
+   if( ( lpk = HPL_dgepack_size( mp, jb ) ) == 0 ) return;
+
+   PANEL->L2P = (double *)malloc( lpk * sizeof( double ) );
+   if( PANEL->L2P != NULL )
+      HPL_dgepack( mp, jb, PANEL->L2, PANEL->ldl2, PANEL->L2P );
+/*
+ * End of HPL_pdpanel_pack
+ */
+}
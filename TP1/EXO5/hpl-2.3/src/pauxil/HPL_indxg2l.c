@@ -74,7 +74,8 @@ int HPL_indxg2l
  *
  * HPL_indxg2l computes  the local index of a matrix entry pointed to by
  * the  global index IG.  This  local  returned index is the same in all
- * processes.
+ * processes. It is read from HPL_ixmap when a map there describes this
+ * distribution.
  *
  * Arguments
  * =========
@@ -106,10 +107,15 @@ int HPL_indxg2l
 /*
  * .. Local Variables ..
  */
+   HPL_T_ixmap                * map;
    int                        i, j;
 /* ..
  * .. Executable Statements ..
  */
+   if( ( IG >= 0 ) &&
+       ( map = Mixmap( IG+1, INB, NB, -1, SRCPROC, NPROCS ) ) != NULL )
+      return( map->g2l[IG] );
+
    if( ( IG < INB ) || ( SRCPROC == -1 ) || ( NPROCS == 1 ) )
 /*
  * IG  belongs  to the first block,  or the data is not distributed,  or
@@ -79,6 +79,8 @@ void HPL_indxg2lp
  * HPL_indxg2lp computes the local index of a matrix entry pointed to by
  * the global  index IG as well as the process coordinate which posseses
  * this entry. The local returned index is the same in all processes.
+ * Both are read from HPL_ixmap when a map there describes this distri-
+ * bution.
  *
  * Arguments
  * =========
@@ -119,10 +121,15 @@ void HPL_indxg2lp
 /*
  * .. Local Variables ..
  */
+   HPL_T_ixmap                * map;
    int                        i, j;
 /* ..
  * .. Executable Statements ..
  */
+   if( ( IG >= 0 ) &&
+       ( map = Mixmap( IG+1, INB, NB, -1, SRCPROC, NPROCS ) ) != NULL )
+   { *IL = map->g2l[IG]; *PROC = map->g2p[IG]; return; }
+
    if( ( IG < INB ) || ( SRCPROC == -1 ) || ( NPROCS == 1 ) )
    {
 /*
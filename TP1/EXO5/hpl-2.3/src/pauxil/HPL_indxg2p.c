@@ -73,7 +73,8 @@ int HPL_indxg2p
  * =======
  *
  * HPL_indxg2p computes the process coordinate  which posseses the entry
- * of a matrix specified by a global index IG.
+ * of a matrix specified by a global index IG.  It is read from HPL_ix-
+ * map when a map there describes this distribution.
  *
  * Arguments
  * =========
@@ -105,10 +106,15 @@ int HPL_indxg2p
 /*
  * .. Local Variables ..
  */
+   HPL_T_ixmap                * map;
    int                        proc;
 /* ..
  * .. Executable Statements ..
  */
+   if( ( IG >= 0 ) &&
+       ( map = Mixmap( IG+1, INB, NB, -1, SRCPROC, NPROCS ) ) != NULL )
+      return( map->g2p[IG] );
+
    if( ( IG < INB ) || ( SRCPROC == -1 ) || ( NPROCS == 1 ) )
 /*
  * IG  belongs  to the first block,  or the data is not distributed,  or
@@ -75,7 +75,8 @@ int HPL_indxl2g
  * =======
  *
  * HPL_indxl2g computes the global index of a matrix  entry  pointed to
- * by the local index IL of the process indicated by PROC.
+ * by the local index IL of the process indicated by PROC.  It is read
+ * from HPL_ixmap when a map there describes this distribution.
  *
  * Arguments
  * =========
@@ -109,9 +110,17 @@ int HPL_indxl2g
  *
  * ---------------------------------------------------------------------
  */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_ixmap                * map;
 /* ..
  * .. Executable Statements ..
  */
+   if( ( map = Mixmap0( INB, NB, PROC, SRCPROC, NPROCS ) ) != NULL &&
+       ( IL >= 0 ) && ( IL < map->np ) )
+      return( map->l2g[IL] );
+
    if( ( SRCPROC == -1 ) || ( NPROCS == 1 ) )
    {
 /*
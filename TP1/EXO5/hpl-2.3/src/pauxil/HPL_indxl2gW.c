@@ -0,0 +1,115 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+int HPL_indxl2gW
+(
+   const int                        JL,
+   const int                        NB,
+   const int                        PCOL,
+   const HPL_T_grid *               GRID
+)
+#else
+int HPL_indxl2gW
+( JL, NB, PCOL, GRID )
+   const int                        JL;
+   const int                        NB;
+   const int                        PCOL;
+   const HPL_T_grid *               GRID;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_indxl2gW returns the global index of the local column JL of the
+ * process column PCOL,  with the column distribution of GRID, that is
+ * HPL_indxl2g when the columns are block-cyclic.
+ *
+ * Arguments
+ * =========
+ *
+ * JL      (input)                       const int
+ *         On entry, JL specifies the local index of the column.  JL
+ *         must be at least zero.
+ *
+ * NB      (input)                       const int
+ *         On entry,  NB specifies the blocking factor used to partition
+ *         and distribute the matrix A. NB must be larger than one.
+ *
+ * PCOL    (input)                       const int
+ *         On entry, PCOL specifies the coordinate of the process column
+ *         owning the local column JL. PCOL must be at least zero and
+ *         strictly less than npcol.
+ *
+ * GRID    (local input)                 const HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   int                        b, c, w;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( GRID->ncyc == 0 )
+      return( HPL_indxl2g( JL, NB, NB, PCOL, 0, GRID->npcol ) );
+
+   w = GRID->cwgt[PCOL]; b = JL / NB; c = b / w; b -= c * w;
+   return( ( c * GRID->ncyc + GRID->cblk[GRID->coff[PCOL] + b] ) * NB +
+           JL - ( JL / NB ) * NB );
+/*
+ * End of HPL_indxl2gW
+ */
+}
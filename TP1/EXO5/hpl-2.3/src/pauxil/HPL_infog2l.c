@@ -97,7 +97,8 @@ void HPL_infog2l
  * HPL_infog2l computes the starting local index II, JJ corresponding to
  * the submatrix starting globally at the entry pointed by  I,  J.  This
  * routine returns the coordinates in the grid of the process owning the
- * matrix entry of global indexes I, J, namely PROW and PCOL.
+ * matrix entry of global indexes I, J, namely PROW and PCOL.  They are
+ * read from  HPL_ixmap  when maps there describe both distributions.
  *
  * Arguments
  * =========
@@ -179,10 +180,20 @@ void HPL_infog2l
 /*
  * .. Local Variables ..
  */
+   HPL_T_ixmap    * cmap, * rmap;
    int            ilocblk, imb, inb, mb, mydist, nb, nblocks, csrc, rsrc;
 /* ..
  * .. Executable Statements ..
  */
+   if( ( I >= 0 ) && ( J >= 0 ) &&
+       ( rmap = Mixmap( I+1, IMB, MB, MYROW, RSRC, NPROW ) ) != NULL &&
+       ( cmap = Mixmap( J+1, INB, NB, MYCOL, CSRC, NPCOL ) ) != NULL )
+   {
+      *II = rmap->cnt[I]; *PROW = rmap->g2p[I];
+      *JJ = cmap->cnt[J]; *PCOL = cmap->g2p[J];
+      return;
+   }
+
    imb   = IMB;
    *PROW = RSRC;
 
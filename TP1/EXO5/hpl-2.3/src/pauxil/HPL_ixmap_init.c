@@ -0,0 +1,161 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+/*
+ * Index maps of the row and column distributions of the current test
+ */
+HPL_T_ixmap                         HPL_ixmap[2];
+
+#ifdef STDC_HEADERS
+void HPL_ixmap_init
+(
+   HPL_T_ixmap *                    MAP,
+   const int                        N,
+   const int                        NB,
+   const int                        PROC,
+   const int                        NPROCS
+)
+#else
+void HPL_ixmap_init
+( MAP, N, NB, PROC, NPROCS )
+   HPL_T_ixmap *                    MAP;
+   const int                        N;
+   const int                        NB;
+   const int                        PROC;
+   const int                        NPROCS;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_ixmap_init tabulates  the block-cyclic distribution of the global
+ * indexes 0:N-1 in blocks of size NB over NPROCS processes starting  at
+ * process 0, so that HPL_numroc, HPL_numrocI, HPL_indxg2l, HPL_indxg2p,
+ * HPL_indxg2lp,  HPL_indxl2g,  HPL_infog2l  and the  corresponding  ma-
+ * cros read the result  instead  of recomputing it.  For every global
+ * index, MAP holds its owner, its local index and the number of indexes
+ * of process PROC that precede it;  for every local index of PROC,  it
+ * holds the corresponding global index. The tables are built in O(N)
+ * operations without divisions.  Any previous content of MAP  is  first
+ * released. When the tables cannot be allocated, MAP is left empty and
+ * the indexes are computed as usual.
+ *
+ * Arguments
+ * =========
+ *
+ * MAP     (local input/output)          HPL_T_ixmap *
+ *         On entry,  MAP  points to the map to be initialized,  usually
+ *         HPL_ixmap[0] for the rows and HPL_ixmap[1] for the columns.
+ *
+ * N       (global input)                const int
+ *         On entry, N specifies the number of global indexes described
+ *         by the map. N must be at least zero.
+ *
+ * NB      (global input)                const int
+ *         On entry,  NB specifies the blocking factor used to partition
+ *         and distribute the indexes. NB must be larger than one.
+ *
+ * PROC    (local input)                 const int
+ *         On entry,  PROC  specifies the coordinate of the process whose
+ *         local indexes are tabulated. PROC must be at least zero  and
+ *         strictly less than NPROCS.
+ *
+ * NPROCS  (global input)                const int
+ *         On entry,  NPROCS  specifies the total number of process rows
+ *         or columns over which the indexes are distributed. NPROCS must
+ *         be at least one.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   int                        * buf;
+   int                        ib, ig, il, iend, lb, np, p;
+/* ..
+ * .. Executable Statements ..
+ */
+   HPL_ixmap_free( MAP );
+   if( ( N <= 0 ) || ( NB <= 0 ) ) return;
+
+   np  = HPL_numroc( N, NB, NB, PROC, 0, NPROCS );
+   buf = (int *)malloc( ( (size_t)(3) * (size_t)(N) + (size_t)(np) +
+                          (size_t)(1) ) * sizeof( int ) );
+   if( buf == NULL ) return;
+
+   MAP->g2p = buf;       MAP->g2l = buf + N;
+   MAP->cnt = buf + 2*N; MAP->l2g = buf + 3*N + 1;
+/*
+ * Walk the blocks once: p owns the block starting at ib, which is its
+ * local block lb.
+ */
+   for( ib = 0, il = 0, lb = 0, p = 0; ib < N; ib += NB )
+   {
+      iend = Mmin( ib + NB, N );
+      for( ig = ib; ig < iend; ig++ )
+      { MAP->g2p[ig] = p; MAP->g2l[ig] = lb * NB + ( ig - ib ); }
+      if( p == PROC )
+      {
+         for( ig = ib; ig < iend; ig++ )
+         { MAP->cnt[ig] = il; MAP->l2g[il++] = ig; }
+      }
+      else
+      { for( ig = ib; ig < iend; ig++ ) MAP->cnt[ig] = il; }
+      if( ++p == NPROCS ) { p = 0; lb++; }
+   }
+   MAP->cnt[N] = il;
+
+   MAP->n      = N;      MAP->nb = NB; MAP->proc = PROC;
+   MAP->nprocs = NPROCS; MAP->np = np;
+/*
+ * End of HPL_ixmap_init
+ */
+}
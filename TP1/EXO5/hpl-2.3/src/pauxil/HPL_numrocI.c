@@ -78,7 +78,8 @@ int HPL_numrocI
  *
  * HPL_numrocI returns  the  local number of matrix rows/columns process
  * PROC  will  get  if  we give out  N rows/columns starting from global
- * index I.
+ * index I.  When HPL_ixmap holds the tables of this distribution,  the
+ * result is the difference of two of their entries.
  *
  * Arguments
  * =========
@@ -119,10 +120,15 @@ int HPL_numrocI
 /*
  * .. Local Variables ..
  */
+   HPL_T_ixmap                * map;
    int                        ilocblk, inb, mydist, nblocks, srcproc;
 /* ..
  * .. Executable Statements ..
  */
+   if( ( I >= 0 ) && ( N >= 0 ) &&
+       ( map = Mixmap( I+N, INB, NB, PROC, SRCPROC, NPROCS ) ) != NULL )
+      return( map->cnt[I+N] - map->cnt[I] );
+
    if( ( SRCPROC == -1 ) || ( NPROCS == 1 ) )
 /*
  * The data is not distributed, or there is just one process in this di-
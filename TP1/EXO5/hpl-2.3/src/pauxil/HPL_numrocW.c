@@ -0,0 +1,134 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+int HPL_numrocW
+(
+   const int                        N,
+   const int                        J,
+   const int                        NB,
+   const int                        PCOL,
+   const HPL_T_grid *               GRID
+)
+#else
+int HPL_numrocW
+( N, J, NB, PCOL, GRID )
+   const int                        N;
+   const int                        J;
+   const int                        NB;
+   const int                        PCOL;
+   const HPL_T_grid *               GRID;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_numrocW returns the local number of matrix columns process column
+ * PCOL will get if we give out N columns starting from global index J,
+ * with the column distribution of GRID.  This is HPL_numrocI when the
+ * columns are block-cyclic, otherwise the count is taken from the cycle
+ * tables set by HPL_grid_wght.
+ *
+ * Arguments
+ * =========
+ *
+ * N       (input)                       const int
+ *         On entry, N  specifies the number of columns being dealt out.
+ *         N must be at least zero.
+ *
+ * J       (input)                       const int
+ *         On entry, J  specifies the global index of the first column.
+ *         J must be at least zero.
+ *
+ * NB      (input)                       const int
+ *         On entry,  NB specifies the blocking factor used to partition
+ *         and distribute the matrix A. NB must be larger than one.
+ *
+ * PCOL    (input)                       const int
+ *         On entry, PCOL specifies the coordinate of the process column
+ *         whose local portion is determined.  PCOL must be at least zero
+ *         and strictly less than npcol.
+ *
+ * GRID    (local input)                 const HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   const int                  * blk;
+   int                        b, c, cnt[2], i, k, w, x;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( GRID->ncyc == 0 )
+      return( HPL_numrocI( N, J, NB, NB, PCOL, 0, GRID->npcol ) );
+/*
+ * Count the columns of PCOL before J and before J+N: the whole cycles,
+ * then the blocks of the last cycle before the one containing the index
+ */
+   w = GRID->cwgt[PCOL]; blk = GRID->cblk + GRID->coff[PCOL];
+   for( i = 0; i < 2; i++ )
+   {
+      x = ( i == 0 ? J : J + N );
+      b = x / NB; c = b / GRID->ncyc; b -= c * GRID->ncyc;
+      cnt[i] = c * w * NB;
+      for( k = 0; ( k < w ) && ( blk[k] <= b ); k++ )
+         cnt[i] += ( blk[k] < b ? NB : x - ( x / NB ) * NB );
+   }
+   return( cnt[1] - cnt[0] );
+/*
+ * End of HPL_numrocW
+ */
+}
@@ -136,7 +136,7 @@ double HPL_pdlange
    Acomm = GRID->all_comm;
 
    Mnumroc( mp, M, NB, NB, myrow, 0, nprow );
-   Mnumroc( nq, N, NB, NB, mycol, 0, npcol );
+   nq = HPL_numrocW( N, 0, NB, mycol, GRID );
 
    if( Mmin( M, N ) == 0 ) { return( v0 ); }
    else if( NORM == HPL_NORM_A )
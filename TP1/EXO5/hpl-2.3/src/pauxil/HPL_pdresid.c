@@ -0,0 +1,370 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+/*
+ * Rows of A processed at once, so that the pieces of the row sums and of
+ * the residual they update stay in the first level of cache while every
+ * column of A is streamed.
+ */
+#define    HPL_PDRESID_MB         256
+
+typedef struct HPL_S_pdresid
+{
+   const double        * A;               /* local piece of [ A | b ] */
+   const double        * X;                       /* local piece of x */
+   double              * S;                        /* row sums of |A| */
+   double              * R;                                /* b - A x */
+   double              * C;        /* column sums of |A|, nq per task */
+   int                 lda;                 /* leading dimension of A */
+   int                 mp;                    /* local # of rows of A */
+   int                 nq;                 /* local # of columns of A */
+   int                 bown;                /* b is held in column nq */
+   int                 ntask;                      /* # of row ranges */
+} HPL_T_pdresid;
+
+#ifdef STDC_HEADERS
+static void HPL_pdresid_rows
+(
+   const HPL_T_pdresid *            P,
+   const int                        I0,
+   const int                        I1,
+   const int                        J0,
+   const int                        J1,
+   double *                         C
+)
+#else
+static void HPL_pdresid_rows( P, I0, I1, J0, J1, C )
+   const HPL_T_pdresid *            P;
+   const int                        I0;
+   const int                        I1;
+   const int                        J0;
+   const int                        J1;
+   double *                         C;
+#endif
+{
+/*
+ * Accumulate the rows I0:I1-1 of the columns J0:J1-1 of A in the row
+ * sums S, the residual R and the column sums C,  one block  of  HPL_PD-
+ * RESID_MB rows at a time;  S and R are cleared when J0 is zero.  Four
+ * partial column sums keep the inner loop free of a serial dependence.
+ */
+   const double               * a;
+   double                     * r, * s;
+   double                     c0, c1, c2, c3, t0, t1, t2, t3, x;
+   int                        i, ib, j, mb;
+
+   for( ib = I0; ib < I1; ib += HPL_PDRESID_MB )
+   {
+      mb = Mmin( I1 - ib, HPL_PDRESID_MB );
+      r  = P->R + ib; s = P->S + ib;
+      if( J0 == 0 )
+      { for( i = 0; i < mb; i++ ) { r[i] = HPL_rzero; s[i] = HPL_rzero; } }
+
+      for( j = J0; j < J1; j++ )
+      {
+         a = Mptr( P->A, ib, j, P->lda ); x = P->X[j];
+         c0 = c1 = c2 = c3 = HPL_rzero;
+         for( i = 0; i < mb - 3; i += 4 )
+         {
+            t0 = Mabs( a[i  ] ); t1 = Mabs( a[i+1] );
+            t2 = Mabs( a[i+2] ); t3 = Mabs( a[i+3] );
+            c0 += t0; c1 += t1; c2 += t2; c3 += t3;
+            s[i  ] += t0; s[i+1] += t1; s[i+2] += t2; s[i+3] += t3;
+            r[i  ] -= a[i  ] * x; r[i+1] -= a[i+1] * x;
+            r[i+2] -= a[i+2] * x; r[i+3] -= a[i+3] * x;
+         }
+         for( ; i < mb; i++ )
+         { t0 = Mabs( a[i] ); c0 += t0; s[i] += t0; r[i] -= a[i] * x; }
+         C[j] += ( c0 + c1 ) + ( c2 + c3 );
+      }
+   }
+}
+
+#ifdef HPL_USE_PTHREADS
+#ifdef STDC_HEADERS
+static int HPL_pdresid_task
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdresid_task( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Task TASK->i processes the TASK->i-th of the ntask row ranges of A.
+ */
+   HPL_T_pdresid              * P = (HPL_T_pdresid *)(TASK->arg);
+   int                        k = TASK->i;
+
+   HPL_pdresid_rows( P, (int)( ( (long)(k)   * P->mp ) / P->ntask ),
+                     (int)( ( (long)(k+1) * P->mp ) / P->ntask ), 0, P->nq,
+                     P->C + (size_t)(k) * (size_t)(P->nq) );
+   return( HPL_SUCCESS );
+}
+#endif
+
+#ifdef STDC_HEADERS
+void HPL_pdresid
+(
+   const HPL_T_grid *               GRID,
+   const int                        NTHRD,
+   const int                        N,
+   const int                        NB,
+   const double *                   A,
+   const int                        LDA,
+   const double *                   X,
+   const HPL_T_PROG_FUN             WAIT,
+   void *                           ARG,
+   double *                         NRM
+)
+#else
+void HPL_pdresid
+( GRID, NTHRD, N, NB, A, LDA, X, WAIT, ARG, NRM )
+   const HPL_T_grid *               GRID;
+   const int                        NTHRD;
+   const int                        N;
+   const int                        NB;
+   const double *                   A;
+   const int                        LDA;
+   const double *                   X;
+   const HPL_T_PROG_FUN             WAIT;
+   void *                           ARG;
+   double *                         NRM;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdresid computes the norms needed by the residual check of the
+ * system A x = b in a single pass over the local pieces of A and b:
+ * the 1-norm and infinity norm of A,  the 1-norm and infinity norm of
+ * x, the infinity norm of b and the infinity norm of  b - A x.  Every
+ * column of A is read once to update the column sums, the row sums and
+ * the residual together,  by NTHRD threads working on distinct ranges
+ * of rows when the threads are enabled.  The row quantities are then
+ * summed in process column 0, the column sums in process row 0, and
+ * the six norms are obtained by a single combined reduction.
+ *
+ * When WAIT is not NULL,  [ A | b ]  may still be in the making by an-
+ * other thread:  the local columns are then processed by the calling
+ * thread one block of NB at a time,  as soon as WAIT returns for them,
+ * so that their reading overlaps with the production of the next ones.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 const HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * NTHRD   (local input)                 const int
+ *         On entry,  NTHRD  specifies  the number of threads that may be
+ *         used. It is ignored when HPL_USE_PTHREADS is not defined.
+ *
+ * N       (global input)                const int
+ *         On entry,  N specifies the order of the matrix A. N must be at
+ *         least zero.
+ *
+ * NB      (global input)                const int
+ *         On entry,  NB specifies the blocking factor used to partition
+ *         and distribute the matrix. NB must be larger than one.
+ *
+ * A       (local input)                 const double *
+ *         On entry, A points to an array of dimension LDA by the local
+ *         number of columns of the N by N+1 matrix [ A | b ],  that con-
+ *         tains the local pieces of A and b distributed as in HPL_pdgesv.
+ *
+ * LDA     (local input)                 const int
+ *         On entry, LDA specifies the leading dimension of the array A.
+ *         LDA must be at least max(1,mp).
+ *
+ * X       (local input)                 const double *
+ *         On entry,  X  points to the local piece of the solution x,  of
+ *         dimension the local number of columns of A,  replicated in
+ *         every process row.
+ *
+ * WAIT    (local input)                 const HPL_T_PROG_FUN
+ *         On entry, WAIT is NULL when [ A | b ] is complete, or the fun-
+ *         ction called with ARG and a number of leading local columns of
+ *         [ A | b ], that must return once these columns are available.
+ *
+ * ARG     (local input/output)          void *
+ *         On entry, ARG is the first argument passed to WAIT.
+ *
+ * NRM     (global output)               double *
+ *         On exit, NRM is an array of dimension 6 that contains in every
+ *         process ||A||_1,  ||A||_oo,  ||x||_1, ||x||_oo, ||b||_oo and
+ *         ||b - A x||_oo in that order.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_pdresid              P;
+#ifdef HPL_USE_PTHREADS
+   HPL_T_tpool                pool;
+   HPL_T_task                 * tasks = NULL;
+   int                        k;
+#endif
+   double                     * work = NULL;
+   int                        i, j, mp, mycol, myrow, npcol, nprow, nq,
+                              ntask;
+/* ..
+ * .. Executable Statements ..
+ */
+   for( i = 0; i < 6; i++ ) NRM[i] = HPL_rzero;
+   if( N <= 0 ) return;
+   (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
+
+   mp = HPL_numroc( N, NB, NB, myrow, 0, nprow );
+   nq = HPL_numrocW( N, 0, NB, mycol, GRID );
+   ntask = 1;
+#ifdef HPL_USE_PTHREADS
+   if( WAIT == NULL )
+      ntask = Mmax( 1, Mmin( NTHRD, mp / HPL_PDRESID_MB ) );
+#endif
+/*
+ * The row sums,  the residual and the 1-norm of x are summed together,
+ * followed by the column sums of every range of rows.
+ */
+   work = (double *)malloc( ( 2 * (size_t)(mp) + 1 + (size_t)(ntask) *
+                              (size_t)(nq) ) * sizeof( double ) );
+   if( work == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdresid", "Memory allocation failed" ); }
+
+   P.A = A; P.X = X; P.lda = LDA; P.mp = mp; P.nq = nq;
+   P.S = work; P.R = work + mp; P.C = work + 2 * mp + 1;
+   P.bown = ( mycol == HPL_indxg2pW( N, NB, GRID ) );
+   P.ntask = ntask;
+   for( j = 0; j < ntask * nq; j++ ) P.C[j] = HPL_rzero;
+
+   if( WAIT != NULL )
+   {
+      for( j = 0; j < nq; j += NB )
+      {
+         WAIT( ARG, Mmin( nq, j + NB ) );
+         HPL_pdresid_rows( &P, 0, mp, j, Mmin( nq, j + NB ), P.C );
+      }
+      WAIT( ARG, nq + P.bown );
+   }
+   else if( ntask == 1 ) { HPL_pdresid_rows( &P, 0, mp, 0, nq, P.C ); }
+#ifdef HPL_USE_PTHREADS
+   else
+   {
+      tasks = (HPL_T_task *)malloc( (size_t)(ntask) *
+                                    sizeof( HPL_T_task ) );
+      if( tasks == NULL )
+      { HPL_pabort( __LINE__, "HPL_pdresid", "Memory allocation failed" ); }
+      for( k = 0; k < ntask; k++ )
+      {
+         tasks[k].fun  = HPL_pdresid_task; tasks[k].arg = (void *)(&P);
+         tasks[k].succ = NULL; tasks[k].next = NULL; tasks[k].prev = NULL;
+         tasks[k].i    = k; tasks[k].j = 0; tasks[k].ndep = 0;
+         tasks[k].nsucc = 0; tasks[k].mastr = 0; tasks[k].seqno = -1;
+         tasks[k].prior = 0;
+      }
+      HPL_tpool_init( &pool, ntask );
+      HPL_tpool_run(  &pool, tasks, ntask );
+      HPL_tpool_exit( &pool );
+      free( tasks );
+
+      for( k = 1; k < ntask; k++ )
+      {
+         for( j = 0; j < nq; j++ )
+            P.C[j] += P.C[(size_t)(k) * (size_t)(nq) + j];
+      }
+   }
+#endif
+/*
+ * b - A x,  local pieces of the norms of x and b,  then the sums over
+ * the process rows and columns
+ */
+   if( nq == 0 ) { for( i = 0; i < 2 * mp; i++ ) work[i] = HPL_rzero; }
+   work[2*mp] = HPL_rzero;
+   for( j = 0; j < nq; j++ )
+   {
+      work[2*mp] += Mabs( X[j] ); NRM[3] = Mmax( NRM[3], Mabs( X[j] ) );
+   }
+   if( P.bown )
+   {
+      for( i = 0; i < mp; i++ )
+      {
+         P.R[i] += *Mptr( A, i, nq, LDA );
+         NRM[4]  = Mmax( NRM[4], Mabs( *Mptr( A, i, nq, LDA ) ) );
+      }
+   }
+   (void) HPL_reduce( (void *)work, 2 * mp + 1, HPL_DOUBLE, HPL_sum, 0,
+                      GRID->row_comm );
+   if( nq > 0 )
+      (void) HPL_reduce( (void *)(P.C), nq, HPL_DOUBLE, HPL_sum, 0,
+                         GRID->col_comm );
+
+   if( mycol == 0 )
+   {
+      NRM[2] = work[2*mp];
+      for( i = 0; i < mp; i++ )
+      {
+         NRM[1] = Mmax( NRM[1], P.S[i] );
+         NRM[5] = Mmax( NRM[5], Mabs( P.R[i] ) );
+      }
+   }
+   if( myrow == 0 )
+   { for( j = 0; j < nq; j++ ) NRM[0] = Mmax( NRM[0], P.C[j] ); }
+
+   (void) HPL_all_reduce( (void *)NRM, 6, HPL_DOUBLE, HPL_max,
+                          GRID->all_comm );
+   free( work );
+/*
+ * End of HPL_pdresid
+ */
+}
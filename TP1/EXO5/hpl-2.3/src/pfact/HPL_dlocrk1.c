@@ -0,0 +1,214 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_dlocrk1
+(
+   HPL_T_panel *                    PANEL,
+   const int                        M,
+   const int                        II,
+   const int                        JJ,
+   const int                        NU,
+   const double *                   Y,
+   double *                         WORK
+)
+#else
+void HPL_dlocrk1
+( PANEL, M, II, JJ, NU, Y, WORK )
+   HPL_T_panel *                    PANEL;
+   const int                        M;
+   const int                        II;
+   const int                        JJ;
+   const int                        NU;
+   const double *                   Y;
+   double *                         WORK;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_dlocrk1 scales the current column of the panel by its pivot,
+ * subtracts it from the next NU columns (rank-1 update) and finds the
+ * local maximum entry in the next column.  For small values of NU, all
+ * of this is done in a single pass through the current column with the
+ * multipliers kept in registers, instead of the dscal/daxpy/idamax/ger
+ * sequence used by the non-recursive panel factorizations.  On exit the
+ * local maximum is packed into WORK[0:3] exactly as HPL_dlocmax does.
+ *
+ * Arguments
+ * =========
+ *
+ * PANEL   (local input/output)          HPL_T_panel *
+ *         On entry,  PANEL  points to the data structure containing the
+ *         panel information.
+ *
+ * M       (local input)                 const int
+ *         On entry,  M specifies the local number of rows of the column
+ *         of A on which we operate.
+ *
+ * II      (local input)                 const int
+ *         On entry, II  specifies the row offset where the column to be
+ *         operated on starts with respect to the panel.
+ *
+ * JJ      (local input)                 const int
+ *         On entry, JJ  specifies the column offset where the column to
+ *         be operated on starts with respect to the panel.
+ *
+ * NU      (local input)                 const int
+ *         On entry,  NU  specifies the number of columns following  the
+ *         current one that are to be updated.  When NU is zero,  the
+ *         current column is only scaled and WORK is left unchanged.
+ *
+ * Y       (local input)                 const double *
+ *         On entry, Y is an array of dimension at least NU that con-
+ *         tains the entries of the pivot row in the columns JJ+1:JJ+NU.
+ *
+ * WORK    (local input/output)          double *
+ *         On entry, WORK[0] contains the pivot value.  On exit, WORK[0]
+ *         contains  the  local  maximum  absolute value scalar of the
+ *         updated column JJ+1, WORK[1] contains the corresponding local
+ *         row index, WORK[2] contains the corresponding global row in-
+ *         dex, and WORK[3] is the coordinate of process owning the max.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   double                     * a0, * a1, * a2, * a3;
+   double                     amax, r, t0, t1, y0, y1, y2;
+   int                        igindx, ilindx, kk, lda;
+   register int               i, j;
+/* ..
+ * .. Executable Statements ..
+ */
+   lda = PANEL->lda;
+   a0  = Mptr( PANEL->A, II, JJ, lda );
+   r   = ( WORK[0] != HPL_rzero ? HPL_rone / WORK[0] : HPL_rone );
+
+   if( NU <= 0 )
+   {
+      if( WORK[0] != HPL_rzero ) HPL_dscal( M, r, a0, 1 );
+      return;
+   }
+
+   a1 = a0 + lda;
+   amax = -HPL_rone; ilindx = 0; y0 = Y[0];
+/*
+ * The multipliers are kept in registers and the next column is updated
+ * and searched while the current entry is still hot.
+ */
+   switch( NU )
+   {
+      case 1:
+         for( i = 0; i < M; i++ )
+         {
+            a0[i] = t0 = a0[i] * r;
+            a1[i] = t1 = a1[i] - t0 * y0;
+            if( Mabs( t1 ) > amax ) { amax = Mabs( t1 ); ilindx = i; }
+         }
+         break;
+      case 2:
+         a2 = a1 + lda; y1 = Y[1];
+         for( i = 0; i < M; i++ )
+         {
+            a0[i] = t0 = a0[i] * r;
+            a1[i] = t1 = a1[i] - t0 * y0;
+            a2[i] -= t0 * y1;
+            if( Mabs( t1 ) > amax ) { amax = Mabs( t1 ); ilindx = i; }
+         }
+         break;
+      case 3:
+         a2 = a1 + lda; a3 = a2 + lda; y1 = Y[1]; y2 = Y[2];
+         for( i = 0; i < M; i++ )
+         {
+            a0[i] = t0 = a0[i] * r;
+            a1[i] = t1 = a1[i] - t0 * y0;
+            a2[i] -= t0 * y1; a3[i] -= t0 * y2;
+            if( Mabs( t1 ) > amax ) { amax = Mabs( t1 ); ilindx = i; }
+         }
+         break;
+      default:
+         for( i = 0; i < M; i++ )
+         {
+            a0[i] = t0 = a0[i] * r;
+            a1[i] = t1 = a1[i] - t0 * y0;
+            if( Mabs( t1 ) > amax ) { amax = Mabs( t1 ); ilindx = i; }
+         }
+         for( j = 1; j < NU; j++ )
+            HPL_daxpy( M, -Y[j], a0, 1, Mptr( a1, 0, j, lda ), 1 );
+         break;
+   }
+/*
+ * WORK[0] := local maximum absolute value scalar,
+ * WORK[1] := corresponding local  row index,
+ * WORK[2] := corresponding global row index,
+ * WORK[3] := coordinate of process owning this max.
+ */
+   if( M > 0 )
+   {
+      kk = PANEL->ii + II + ilindx;
+      Mindxl2g( igindx, kk, PANEL->nb, PANEL->nb, PANEL->grid->myrow, 0,
+                PANEL->grid->nprow );
+      WORK[0] = a1[ilindx];       WORK[1] = (double)(ilindx);
+      WORK[2] = (double)(igindx);
+      WORK[3] = (double)(PANEL->grid->myrow);
+   }
+   else
+   {
+      WORK[0] = WORK[1] = WORK[2] = HPL_rzero;
+      WORK[3] = (double)(PANEL->grid->nprow);
+   }
+/*
+ * End of HPL_dlocrk1
+ */
+}
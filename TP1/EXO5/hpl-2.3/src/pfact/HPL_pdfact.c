@@ -73,7 +73,10 @@ void HPL_pdfact
  * PFACT is a function pointer specifying the non-recursive algorithm to
  * to be used on at most NBMIN columns. One can also choose here between
  * Crout, Left- or Right looking.  Empirical tests seem to indicate that
- * values of 4 or 8 for NBMIN give the best results.
+ * values of 4 or 8 for NBMIN give the best results.  When the matrix
+ * keeps a record of its panels (PANEL->pmat->R), L1, DPIV and DINFO are
+ * copied into that record once the panel is factored, so that the fac-
+ * tors can be applied to other right-hand sides later on.
  *  
  * Bi-directional  exchange  is  used  to  perform  the  swap::broadcast
  * operations  at once  for one column in the panel.  This  results in a
@@ -130,6 +133,14 @@ void HPL_pdfact
                        ((size_t)(align) * sizeof(double) ) ) );
    if( vptr ) free( vptr );
 
+   if( PANEL->pmat->R != NULL )
+      (void) memcpy( (void *)( PANEL->pmat->R +
+                               (size_t)( PANEL->jj / PANEL->nb ) *
+                               (size_t)( PANEL->nb * PANEL->nb +
+                                         PANEL->nb + 1 ) ),
+                     (const void *)(PANEL->L1),
+                     (size_t)( jb * jb + jb + 1 ) * sizeof( double ) );
+
    PANEL->A   = Mptr( PANEL->A, 0, jb, PANEL->lda );
    PANEL->nq -= jb; PANEL->jj += jb;
 #ifdef HPL_DETAILED_TIMING
@@ -0,0 +1,218 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+/*
+ * Define default value for the width of the base case
+ */
+#ifndef HPL_PANRR_NBASE
+#define    HPL_PANRR_NBASE          4
+#endif
+
+#ifdef STDC_HEADERS
+void HPL_pdpanrrT
+(
+   HPL_T_panel *                    PANEL,
+   const int                        M,
+   const int                        N,
+   const int                        ICOFF,
+   double *                         WORK
+)
+#else
+void HPL_pdpanrrT
+( PANEL, M, N, ICOFF, WORK )
+   HPL_T_panel *                    PANEL;
+   const int                        M;
+   const int                        N;
+   const int                        ICOFF;
+   double *                         WORK;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdpanrrT factorizes a panel of columns that is a sub-array of a
+ * larger one-dimensional panel A using a binary recursive variant of
+ * the Right-looking algorithm.  The lower triangular N0-by-N0 upper
+ * block of the panel is stored in transpose form.
+ *  
+ * The columns are split in two halves until at most HPL_PANRR_NBASE of
+ * them remain.  The left half is factored recursively, the replicated
+ * upper part of the right half is solved for, and the local rows of
+ * the right half are updated with a single matrix-matrix multiply be-
+ * fore the right half is in turn factored.  Almost all floating point
+ * operations are thus performed by dtrsm and dgemm, whatever the value
+ * of NBMIN.  In the base case, the scaling of the current column, the
+ * update of the remaining columns and the search for the next pivot
+ * are fused in a single pass through the local rows (see HPL_dlocrk1).
+ *  
+ * The communication pattern is the one of the other panel factoriza-
+ * tion variants: one swap::broadcast per column, so that the running
+ * time of this function can be approximated by (when N is equal to
+ * N0):
+ *  
+ *    N0 * log_2( P ) * ( lat + ( 2*N0 + 4 ) / bdwth ) +
+ *    N0^2 * ( M - N0/3 ) * gam3
+ *  
+ * where M is the local number of rows of  the panel, lat and bdwth  are
+ * the latency and bandwidth of the network for  double  precision  real
+ * words, and gam3 is an estimate of the Level 3 BLAS rate of execution.
+ *
+ * Arguments
+ * =========
+ *
+ * PANEL   (local input/output)          HPL_T_panel *
+ *         On entry,  PANEL  points to the data structure containing the
+ *         panel information.
+ *
+ * M       (local input)                 const int
+ *         On entry,  M specifies the local number of rows of sub(A).
+ *
+ * N       (local input)                 const int
+ *         On entry,  N specifies the local number of columns of sub(A).
+ *
+ * ICOFF   (global input)                const int
+ *         On entry, ICOFF specifies the row and column offset of sub(A)
+ *         in A.
+ *
+ * WORK    (local workspace)             double *
+ *         On entry, WORK  is a workarray of size at least 2*(4+2*N0).
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   double                     * A, * Aptr, * L1, * L1ptr;
+   int                        Mm1, Nm1, curr, ii, iip1, jj, lda, m=M,
+                              n0, n1, n2;
+/* ..
+ * .. Executable Statements ..
+ */
+   A    = PANEL->A;   lda = PANEL->lda;
+   L1   = PANEL->L1;  n0  = PANEL->jb;
+   curr = (int)( PANEL->grid->myrow == PANEL->prow );
+
+   if( N > HPL_PANRR_NBASE )
+   {
+/*
+ * Split the columns in two halves,  the first one being a multiple  of
+ * the base case width. This guarantees 1 <= n1 < N since N > NBASE.
+ */
+      n1 = ( ( ( N >> 1 ) + HPL_PANRR_NBASE - 1 ) / HPL_PANRR_NBASE ) *
+           HPL_PANRR_NBASE;
+      n2 = N - n1;
+
+      L1ptr = Mptr( L1, ICOFF, ICOFF, n0 );
+      if( curr != 0 ) { Aptr = Mptr( A, ICOFF, ICOFF, lda ); ii = n1; }
+      else            { Aptr = Mptr( A,     0, ICOFF, lda ); ii = 0;  }
+/*
+ * Factor left half - Replicated solve - Local update of the right half
+ */
+      HPL_pdpanrrT( PANEL, M, n1, ICOFF, WORK );
+      HPL_dtrsm( HplColumnMajor, HplRight, HplUpper, HplNoTrans,
+                 HplUnit, n2, n1, HPL_rone, L1ptr, n0,
+                 Mptr( L1ptr, n1, 0, n0 ), n0 );
+      HPL_dgemm( HplColumnMajor, HplNoTrans, HplTrans, M-ii, n2,
+                 n1, -HPL_rone, Mptr( Aptr, ii, 0, lda ), lda,
+                 Mptr( L1ptr, n1, 0, n0 ), n0, HPL_rone,
+                 Mptr( Aptr, ii, n1, lda ), lda );
+      if( curr != 0 )
+         HPL_dlatcpy( ICOFF, n1, Mptr( L1, ICOFF, 0, n0 ), n0,
+                      Mptr( A, 0, ICOFF, lda ), lda );
+/*
+ * Factor right half - Copy back upper part of A in current process row
+ */
+      HPL_pdpanrrT( PANEL, M-ii, n2, ICOFF+n1, WORK );
+      if( curr != 0 )
+         HPL_dlatcpy( ICOFF+n1, n2, Mptr( L1, ICOFF+n1, 0, n0 ), n0,
+                      Mptr( A, 0, ICOFF+n1, lda ), lda );
+      return;
+   }
+#ifdef HPL_DETAILED_TIMING
+   HPL_ptimer( HPL_TIMING_PFACT );
+#endif
+   Nm1 = N - 1; jj = ICOFF;
+   if( curr != 0 ) { ii = ICOFF; iip1 = ii+1; Mm1 = m-1; }
+   else            { ii = 0;     iip1 = ii;   Mm1 = m;   }
+/*
+ * Find local absolute value max in first column - initialize WORK[0:3]
+ */
+   HPL_dlocmax( PANEL, m, ii, jj, WORK );
+
+   while( Nm1 >= 1 )
+   {
+/*
+ * Swap and broadcast the current row - Scale current column, update the
+ * remaining ones and find local absolute value max in next column
+ */
+      HPL_pdmxswp(  PANEL, m, ii, jj, WORK );
+      HPL_dlocswpT( PANEL,    ii, jj, WORK );
+      HPL_dlocrk1(  PANEL, Mm1, iip1, jj, Nm1, Mptr( L1, jj+1, jj, n0 ),
+                    WORK );
+
+      if( curr != 0 ) { ii = iip1; iip1++; m = Mm1; Mm1--; }
+
+      Nm1--; jj++;
+   }
+/*
+ * Swap and broadcast last row - Scale last column by its absolute value
+ * max entry
+ */ 
+   HPL_pdmxswp(  PANEL, m, ii, jj, WORK );
+   HPL_dlocswpT( PANEL,    ii, jj, WORK );
+   HPL_dlocrk1(  PANEL, Mm1, iip1, jj, 0, NULL, WORK );
+#ifdef HPL_DETAILED_TIMING
+   HPL_ptimer( HPL_TIMING_PFACT );
+#endif
+/*
+ * End of HPL_pdpanrrT
+ */
+}
@@ -140,16 +140,19 @@ void HPL_equil
  *         IPMAP: For i in [0.. NPROCS) IPMAPM1[IPMAP[i]] = i.
  *
  * IWORK   (workspace)                   int *
- *         On entry, IWORK is a workarray of dimension NPROW+1.
+ *         On entry, IWORK is a workarray of dimension 4*NPROW.
  *
  * ---------------------------------------------------------------------
  */ 
 /*
  * .. Local Variables ..
  */
-   int                        i, ip, ipU, ipcur, iprow, iptgt, lastrow,
-                              left, npm1, nprow, ll, llU, llcur, lltgt,
-                              right, slen, smax, smin;
+   MPI_Datatype               row, rrow, rtype, type;
+   int                        * rcnt, * rdsp, * scnt, * sdsp;
+   double                     dummy, * W = NULL, * rbuf, * sbuf;
+   int                        c0, c1, i, ierr, ip, iprow, ll, lo, me, hi,
+                              npm1, nprow, nrecv, slen, smax, smin,
+                              t0, t1, u0, u1;
 /* ..
  * .. Executable Statements ..
  */
@@ -173,75 +176,119 @@ void HPL_equil
    if( iprow == nprow ) return;
 /*
  * Now,  we are sure  the distribution of the pieces of U is not optimal
- * with respect to the rolling phase,  thus  perform  equilibration.  Go
- * through the list of processes:  Processes  that have rows that do not
- * belong to them  with respect to the optimal mapping spread them  in a
- * logarithmic fashion. To simplify a little bit the implementation, and
- * mainly the packing, a source process row spreads its data to its left
- * first, and then to its right.
+ * with respect to the rolling phase,  thus  perform  equilibration.  The
+ * rows owned by a process before and after equilibration are contiguous
+ * ranges [IPLEN[i],IPLEN[i+1]) and [t(i),t(i+1)),  where t is the prefix
+ * sum of the optimal lengths.  The rows  a process sends to (resp. recei-
+ * ves from) another one are  thus the intersection of its current  (resp.
+ * optimal) range with the optimal (resp. current) range of the other.
+ * All of them are exchanged at once within the process column.
  */
-   IWORK[nprow] = slen;
+   scnt = IWORK;         sdsp = scnt + nprow;
+   rcnt = sdsp + nprow;  rdsp = rcnt + nprow;
 
-   for( iprow = 0; iprow < nprow; iprow++ )
-   {
-      llU = IPLEN[iprow+1] - ( ipU = IPLEN[iprow] );
-      if( iprow < ip ) { lltgt = smax; iptgt = iprow * smax;      }
-      else             { lltgt = smin; iptgt = iprow * smin + ip; }
+   me = IPMAPM1[PANEL->grid->myrow];
+   c0 = IPLEN[me];  c1 = IPLEN[me+1];
+   u0 = ( me < ip ? me * smax : me * smin + ip );
+   u1 = u0 + ( me < ip ? smax : smin );
+   nrecv = 0;
 
-      left = ( ipU < iptgt ); right = ( iptgt + lltgt < ipU + llU );
+   for( i = 0; i < nprow; i++ )
+   {
+      t0 = ( i < ip ? i * smax : i * smin + ip );
+      t1 = t0 + ( i < ip ? smax : smin );
 /*
- * If I have something to spread to either the left or the right
+ * Rows [c0,c1) of mine going to the optimal range of i
  */
-      if( ( llU > 0 ) && ( left || right ) )
-      {        /* Figure out how much every other process should have */
-
-         ipcur = ipU; llcur = llU;
+      lo = Mmax( c0, t0 ); hi = Mmin( c1, t1 ); ll = Mmax( hi - lo, 0 );
+      if( i == me ) ll = 0;
+      scnt[IPMAP[i]] = ll; sdsp[IPMAP[i]] = lo - c0;
+/*
+ * Rows of my optimal range [u0,u1) currently in process i
+ */
+      lo = Mmax( u0, IPLEN[i] ); hi = Mmin( u1, IPLEN[i+1] );
+      ll = Mmax( hi - lo, 0 );
+      if( i == me ) ll = 0;
+      rcnt[IPMAP[i]] = ll; rdsp[IPMAP[i]] = lo - u0; nrecv += ll;
+   }
+/*
+ * The rows are received in the workspace W, that holds the optimal range
+ * [u0,u1) in the storage form of U,  since MPI does not allow the send
+ * and receive buffers to overlap.  They are copied into U afterwards.
+ */
+   ll = u1 - u0;
+   if( ( nrecv > 0 ) && ( N > 0 ) )
+   {
+      W = (double *)malloc( (size_t)(ll) * (size_t)(N) * sizeof( double ) );
+      if( W == NULL )
+      { HPL_pabort( __LINE__, "HPL_equil", "Memory allocation failed" ); }
+   }
+/*
+ * One row of U and of W, with an extent such that the displacements are
+ * counted in rows.
+ */
+   if( TRANS == HplNoTrans )
+   {
+      ierr =      MPI_Type_vector( N, 1, LDU, MPI_DOUBLE, &row );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_create_resized( row, 0, (MPI_Aint)
+                                           sizeof( double ), &type );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_vector( N, 1, Mmax( 1, ll ), MPI_DOUBLE, &rrow );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_create_resized( rrow, 0, (MPI_Aint)
+                                           sizeof( double ), &rtype );
+      sbuf = Mptr( U, c0, 0, LDU );
+   }
+   else
+   {
+      ierr =      MPI_Type_contiguous( N, MPI_DOUBLE, &row );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_create_resized( row, 0, (MPI_Aint)(LDU) *
+                                           (MPI_Aint)sizeof( double ),
+                                           &type );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_contiguous( N, MPI_DOUBLE, &rrow );
+      if( ierr == MPI_SUCCESS )
+         ierr =   MPI_Type_create_resized( rrow, 0, (MPI_Aint)(N) *
+                                           (MPI_Aint)sizeof( double ),
+                                           &rtype );
+      sbuf = Mptr( U, 0, c0, LDU );
+   }
+   if( ierr == MPI_SUCCESS ) ierr = MPI_Type_commit( &type );
+   if( ierr == MPI_SUCCESS ) ierr = MPI_Type_commit( &rtype );
+   if( ierr == MPI_SUCCESS ) ierr = MPI_Type_free( &row );
+   if( ierr == MPI_SUCCESS ) ierr = MPI_Type_free( &rrow );
+   rbuf = ( W ? W : &dummy );
+/*
+ * Probe for column panel - forward it when available
+ */
+   if( *IFLAG == HPL_KEEP_TESTING ) (void) HPL_bcast( PBCST, IFLAG );
 
-         for( i = 0; i < nprow; i++ )
-         {
-            if( i < ip ) { lltgt = smax; iptgt = i * smax;      }
-            else         { lltgt = smin; iptgt = i * smin + ip; }
-            lastrow = iptgt + lltgt - 1;
+   if( ierr == MPI_SUCCESS )
+      ierr = MPI_Alltoallv( sbuf, scnt, sdsp, type, rbuf, rcnt, rdsp, rtype,
+                            PANEL->grid->col_comm );
+   if( ierr == MPI_SUCCESS ) ierr = MPI_Type_free( &type );
+   if( ierr == MPI_SUCCESS ) ierr = MPI_Type_free( &rtype );
 
-            if( ( lastrow >= ipcur ) && ( llcur > 0 ) )
-            { ll = lastrow - ipcur + 1; ll = Mmin( ll, llcur ); llcur -= ll; }
-            else { ll = 0; }
+   if( ierr != MPI_SUCCESS )
+   { HPL_pabort( __LINE__, "HPL_equil", "MPI call failed" ); }
 
-            IWORK[i] = ipcur; ipcur += ll; IWORK[i+1] = ipcur;
-         }
+   if( *IFLAG == HPL_KEEP_TESTING ) (void) HPL_bcast( PBCST, IFLAG );
 /*
- * Equilibration phase
+ * Copy the rows received into their place in U
  */
-         if( TRANS == HplNoTrans )
-         {
-            if( left  )
-            {
-               HPL_spreadN( PBCST, IFLAG, PANEL, HplLeft,  N, U, LDU,
-                            iprow, IWORK, IPMAP, IPMAPM1 );
-            }
-
-            if( right )
-            {
-               HPL_spreadN( PBCST, IFLAG, PANEL, HplRight, N, U, LDU,
-                            iprow, IWORK, IPMAP, IPMAPM1 );
-            }
-         }
-         else
-         {
-            if( left  )
-            {
-               HPL_spreadT( PBCST, IFLAG, PANEL, HplLeft,  N, U, LDU,
-                            iprow, IWORK, IPMAP, IPMAPM1 );
-            }
-
-            if( right )
-            {
-               HPL_spreadT( PBCST, IFLAG, PANEL, HplRight, N, U, LDU,
-                            iprow, IWORK, IPMAP, IPMAPM1 );
-            }
-         }
-      }
+   for( i = 0; ( W != NULL ) && ( i < nprow ); i++ )
+   {
+      if( rcnt[i] <= 0 ) continue;
+      if( TRANS == HplNoTrans )
+         HPL_dlacpy( rcnt[i], N, Mptr( W, rdsp[i], 0, ll ), ll,
+                     Mptr( U, u0 + rdsp[i], 0, LDU ), LDU );
+      else
+         HPL_dlacpy( N, rcnt[i], Mptr( W, 0, rdsp[i], N ), N,
+                     Mptr( U, 0, u0 + rdsp[i], LDU ), LDU );
    }
+   if( W ) free( W );
 /*
  * Finally update  IPLEN  with the indexes corresponding to the new dis-
  * tribution of U - IPLEN[nprow] remained unchanged.
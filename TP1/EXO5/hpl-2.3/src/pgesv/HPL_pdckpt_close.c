@@ -0,0 +1,123 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifdef STDC_HEADERS
+void HPL_pdckpt_close
+(
+   HPL_T_ckpt *                     CKPT,
+   const int                        DONE
+)
+#else
+void HPL_pdckpt_close
+( CKPT, DONE )
+   HPL_T_ckpt *                     CKPT;
+   const int                        DONE;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdckpt_close waits for the flush in flight, if any, releases the
+ * checkpoint files of this process  and records the statistics of the
+ * factorization in HPL_ckst.
+ *
+ * Arguments
+ * =========
+ *
+ * CKPT    (local input/output)          HPL_T_ckpt *
+ *         On entry,  CKPT  points to the checkpoint descriptor.
+ *
+ * DONE    (local input)                 const int
+ *         On entry, DONE is nonzero when the factorization is complete,
+ *         in which case the checkpoint files are removed.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   char                       * name;
+   double                     time;
+   int                        slot;
+/* ..
+ * .. Executable Statements ..
+ */
+   time = HPL_timer_walltime();
+#ifdef HPL_USE_PTHREADS
+   if( CKPT->busy ) (void) pthread_join( CKPT->thread, NULL );
+#endif
+   CKPT->busy = 0;
+   CKPT->tsnap += HPL_timer_walltime() - time;
+
+   name = (char *)malloc( strlen( CKPT->name ) + 8 );
+   if( name == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdckpt_close", "Memory allocation failed" ); }
+
+   for( slot = 0; slot < 2; slot++ )
+   {
+      if( CKPT->map[slot] == NULL ) continue;
+      (void) munmap( CKPT->map[slot], CKPT->len );
+      (void) close( CKPT->fd[slot] );
+      CKPT->map[slot] = NULL; CKPT->fd[slot] = -1;
+      (void) sprintf( name, "%s.%d", CKPT->name, slot );
+      if( DONE ) (void) unlink( name );
+   }
+   free( name ); free( CKPT->name ); CKPT->name = NULL;
+
+   HPL_ckst.nbyte  = CKPT->nbyte; HPL_ckst.tsnap = CKPT->tsnap;
+   HPL_ckst.tflush = CKPT->tflush; HPL_ckst.nckpt = CKPT->nckpt;
+/*
+ * End of HPL_pdckpt_close
+ */
+}
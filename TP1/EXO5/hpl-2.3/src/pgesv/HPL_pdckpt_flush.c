@@ -0,0 +1,104 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <sys/mman.h>
+
+#ifdef STDC_HEADERS
+void * HPL_pdckpt_flush
+(
+   void *                           ARG
+)
+#else
+void * HPL_pdckpt_flush
+( ARG )
+   void *                           ARG;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdckpt_flush writes the last checkpoint  taken by  HPL_pdckpt_save
+ * back to its file and marks it valid once it is on disk.  The valid
+ * flag is flushed last, so that a checkpoint interrupted at any point
+ * is never resumed from.  This is the start routine of the background
+ * flush thread;  it is called directly when  POSIX  threads  are  not
+ * available.
+ *
+ * Arguments
+ * =========
+ *
+ * ARG     (local input/output)          void *
+ *         On entry, ARG points to the checkpoint descriptor.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_ckpt                 * ckpt = (HPL_T_ckpt *)(ARG);
+   int                        * head;
+   double                     time;
+/* ..
+ * .. Executable Statements ..
+ */
+   time = HPL_timer_walltime();
+   head = (int *)(ckpt->map[ckpt->seq & 1]);
+
+   (void) msync( (void *)head, ckpt->len, MS_SYNC );
+   head[HPL_CKPT_VALID] = 1;
+   (void) msync( (void *)head, ckpt->hlen, MS_SYNC );
+
+   ckpt->tflush += HPL_timer_walltime() - time;
+   return( NULL );
+/*
+ * End of HPL_pdckpt_flush
+ */
+}
@@ -0,0 +1,191 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <sys/mman.h>
+
+#ifdef STDC_HEADERS
+int HPL_pdckpt_load
+(
+   HPL_T_ckpt *                     CKPT,
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A,
+   HPL_T_panel * *                  PANEL,
+   int *                            STATE
+)
+#else
+int HPL_pdckpt_load
+( CKPT, GRID, ALGO, A, PANEL, STATE )
+   HPL_T_ckpt *                     CKPT;
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+   HPL_T_panel * *                  PANEL;
+   int *                            STATE;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdckpt_load  resumes the factorization of A from the most recent
+ * checkpoint that every process holds,  if any.  A process may be one
+ * checkpoint ahead of the others when the run was interrupted,  so the
+ * processes agree on the smallest of their latest valid sequence num-
+ * bers  and check that it is still available everywhere.  Otherwise, the
+ * checkpoint files are invalidated and the factorization starts over.
+ * This routine must be called by all processes of the grid.
+ *
+ * Arguments
+ * =========
+ *
+ * CKPT    (local input/output)          HPL_T_ckpt *
+ *         On entry,  CKPT  points to the checkpoint descriptor initia-
+ *         lized by HPL_pdckpt_open.
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local output)                HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information. On exit, the local array is restored when
+ *         the factorization is resumed.
+ *
+ * PANEL   (local output)                HPL_T_panel * *
+ *         On exit, when the factorization is resumed,  PANEL  holds the
+ *         ALGO->depth look-ahead panels of the checkpoint.
+ *
+ * STATE   (local output)                int *
+ *         On exit, when the factorization is resumed,  STATE  holds the
+ *         HPL_CKPT_NSTATE entries of the loop state of HPL_pdgesvK2.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_panel                * p;
+   double                     * rec;
+   int                        * head, * meta;
+   size_t                     la;
+   int                        i, ia, jb, k, ml2, seq, slot, valid[2];
+/* ..
+ * .. Executable Statements ..
+ */
+   for( slot = 0; slot < 2; slot++ )
+   {
+      HPL_pdckpt_map( CKPT, slot );
+      head = (int *)(CKPT->map[slot]); valid[slot] = 0;
+      if( head[HPL_CKPT_VALID] != 1 ) continue;
+      for( i = 0; i < HPL_CKPT_NKEY; i++ )
+      { if( head[HPL_CKPT_KEY+i] != CKPT->key[i] ) break; }
+      if( i == HPL_CKPT_NKEY ) valid[slot] = head[HPL_CKPT_SEQ];
+   }
+   seq = Mmax( valid[0], valid[1] );
+   (void) HPL_all_reduce( (void *)(&seq), 1, HPL_INT, HPL_min,
+                          GRID->all_comm );
+   slot = seq & 1; i = ( seq > 0 ) && ( valid[slot] == seq );
+   (void) HPL_all_reduce( (void *)(&i), 1, HPL_INT, HPL_min,
+                          GRID->all_comm );
+   if( i == 0 )
+   {
+      for( slot = 0; slot < 2; slot++ )
+      {
+         head = (int *)(CKPT->map[slot]); head[HPL_CKPT_VALID] = 0;
+         (void) msync( (void *)head, CKPT->hlen, MS_SYNC );
+      }
+      CKPT->seq = 0;
+      return( 0 );
+   }
+/*
+ * Restore the loop state, the local array and the look-ahead panels
+ */
+   head = (int *)(CKPT->map[slot]); CKPT->seq = seq;
+   for( i = 0; i < HPL_CKPT_NSTATE; i++ ) STATE[i] = head[HPL_CKPT_STATE+i];
+   CKPT->jjs[slot] = STATE[2]; CKPT->jjs[slot^1] = 0;
+
+   la  = (size_t)(A->ld) * (size_t)(A->nq);
+   rec = (double *)( (char *)(head) + CKPT->hlen );
+   (void) memcpy( (void *)(A->A), (const void *)rec, la * sizeof( double ) );
+
+   for( k = 0, rec += la; k < ALGO->depth; k++, rec += CKPT->plen )
+   {
+/*
+ * HPL_pdfact moves ja past the panel in the processes it was called in
+ */
+      meta = head + HPL_CKPT_PANEL + HPL_CKPT_NPANEL * k;
+      ia   = meta[0]; jb = meta[1];
+      HPL_pdpanel_new( GRID, ALGO, A->n - ia, A->n - ia + 1, jb, A, ia, ia,
+                       meta[5], &PANEL[k] );
+      p = PANEL[k]; p->ja = meta[2]; p->n = A->n + 1 - meta[2];
+      p->nq = meta[3]; p->jj = meta[4];
+      p->A  = Mptr( A->A, p->ii, p->jj, A->ld );
+
+      (void) memcpy( (void *)(p->L1), (const void *)rec,
+                     (size_t)(jb * jb + jb + 1) * sizeof( double ) );
+#ifndef HPL_COPY_L
+      if( GRID->mycol == p->pcol ) continue;
+#endif
+      ml2 = p->mp - ( GRID->myrow == p->prow ? jb : 0 );
+      ml2 = Mmax( 0, ml2 );
+      HPL_dlacpy( ml2, jb, rec + jb * jb + jb + 1, Mmax( 1, ml2 ), p->L2,
+                  p->ldl2 );
+   }
+   HPL_ckst.jrst = STATE[0];
+   return( 1 );
+/*
+ * End of HPL_pdckpt_load
+ */
+}
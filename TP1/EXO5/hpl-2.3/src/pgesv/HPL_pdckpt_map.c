@@ -0,0 +1,121 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifdef STDC_HEADERS
+void HPL_pdckpt_map
+(
+   HPL_T_ckpt *                     CKPT,
+   const int                        SLOT
+)
+#else
+void HPL_pdckpt_map
+( CKPT, SLOT )
+   HPL_T_ckpt *                     CKPT;
+   const int                        SLOT;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdckpt_map maps the checkpoint file  SLOT  of this process into
+ * memory, creating it when it does not exist yet. The file is resized
+ * to CKPT->len bytes, so that the header of a file left by a run with
+ * different parameters does not match the key of this one.  Nothing is
+ * done when the slot is already mapped.
+ *
+ * Arguments
+ * =========
+ *
+ * CKPT    (local input/output)          HPL_T_ckpt *
+ *         On entry,  CKPT  points to the checkpoint descriptor.  On
+ *         exit, CKPT->map[SLOT] and CKPT->fd[SLOT] are set.
+ *
+ * SLOT    (local input)                 const int
+ *         On entry, SLOT is the checkpoint slot to map, 0 or 1.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   char                       * name;
+   void                       * map;
+   int                        fd;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( CKPT->map[SLOT] != NULL ) return;
+
+   name = (char *)malloc( strlen( CKPT->name ) + 8 );
+   if( name == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdckpt_map", "Memory allocation failed" ); }
+   (void) sprintf( name, "%s.%d", CKPT->name, SLOT );
+
+   fd = open( name, O_RDWR | O_CREAT, 0600 );
+   if( fd < 0 )
+   { HPL_pabort( __LINE__, "HPL_pdckpt_map", "Cannot open %s", name ); }
+   if( ftruncate( fd, (off_t)(CKPT->len) ) != 0 )
+   { HPL_pabort( __LINE__, "HPL_pdckpt_map", "Cannot resize %s", name ); }
+
+   map = mmap( NULL, CKPT->len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   if( map == MAP_FAILED )
+   { HPL_pabort( __LINE__, "HPL_pdckpt_map", "Cannot map %s", name ); }
+
+   CKPT->map[SLOT] = map; CKPT->fd[SLOT] = fd;
+   free( name );
+/*
+ * End of HPL_pdckpt_map
+ */
+}
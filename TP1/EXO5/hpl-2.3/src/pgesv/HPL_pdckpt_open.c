@@ -0,0 +1,166 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <unistd.h>
+/*
+ * The checkpoint statistics of the last factorization of this process
+ */
+HPL_T_ckst                          HPL_ckst;
+
+#ifdef STDC_HEADERS
+void HPL_pdckpt_open
+(
+   HPL_T_ckpt *                     CKPT,
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A
+)
+#else
+void HPL_pdckpt_open
+( CKPT, GRID, ALGO, A )
+   HPL_T_ckpt *                     CKPT;
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdckpt_open initializes the checkpoint descriptor  CKPT  of  the
+ * factorization  of  A.  A checkpoint consists of  a header  of  hlen
+ * bytes followed by the local array A  and one record of plen doubles
+ * per look-ahead panel. The header holds the entries HPL_CKPT_VALID to
+ * HPL_CKPT_PANEL;  the key identifies the run parameters a checkpoint
+ * can be resumed with, including the forms of L1 and U that the panel
+ * records are stored in.  The two checkpoint files of this process, the
+ * prefix ALGO->ckptf followed by the rank and the slot number, are not
+ * opened here, see HPL_pdckpt_map.
+ *
+ * Arguments
+ * =========
+ *
+ * CKPT    (local output)                HPL_T_ckpt *
+ *         On entry,  CKPT  points  to the checkpoint descriptor to ini-
+ *         tialize.
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input)                 HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   int                        * key;
+   size_t                     hlen, page;
+   int                        i;
+/* ..
+ * .. Executable Statements ..
+ */
+   CKPT->map[0] = CKPT->map[1] = NULL; CKPT->fd[0] = CKPT->fd[1] = -1;
+   CKPT->every  = ALGO->ckpt;          CKPT->depth = ALGO->depth;
+   CKPT->seq    = 0;                   CKPT->busy  = 0;
+   CKPT->jjs[0] = CKPT->jjs[1] = 0;
+   CKPT->nbyte  = CKPT->tsnap = CKPT->tflush = HPL_rzero;
+   CKPT->nckpt  = 0;
+/*
+ * The run parameters a checkpoint depends on
+ */
+   key = CKPT->key;
+   for( i = 0; i < HPL_CKPT_NKEY; i++ ) key[i] = 0;
+   key[ 0] = HPL_CKPT_MAGIC;    key[ 1] = (int)sizeof( double );
+   key[ 2] = A->n;              key[ 3] = A->nb;
+   key[ 4] = A->ld;             key[ 5] = A->mp;
+   key[ 6] = A->nq;             key[ 7] = GRID->nprow;
+   key[ 8] = GRID->npcol;       key[ 9] = GRID->myrow;
+   key[10] = GRID->mycol;       key[11] = (int)(GRID->order);
+   key[12] = ALGO->depth;       key[13] = (int)(ALGO->btopo);
+   key[14] = (int)(ALGO->pfact); key[15] = ALGO->nbmin;
+   key[16] = ALGO->nbdiv;       key[17] = (int)(ALGO->rfact);
+   key[18] = (int)(ALGO->fswap); key[19] = ALGO->fsthr;
+   key[20] = ALGO->equil;       key[21] = ALGO->align;
+   key[22] = ( ( ALGO->upfun == HPL_pdupdateNN ) ||
+               ( ALGO->upfun == HPL_pdupdateNT ) );
+   key[23] = ( ( ALGO->upfun == HPL_pdupdateNN ) ||
+               ( ALGO->upfun == HPL_pdupdateTN ) );
+/*
+ * The header is rounded up to a page so that A is page-aligned in  the
+ * mapping.  A panel record holds L1, DPIV and DINFO followed by L2.
+ */
+   page = (size_t)sysconf( _SC_PAGESIZE );
+   hlen = (size_t)( HPL_CKPT_PANEL + HPL_CKPT_NPANEL * ALGO->depth ) *
+          sizeof( int );
+   CKPT->hlen = ( ( hlen + page - 1 ) / page ) * page;
+   CKPT->plen = (size_t)(A->nb) * (size_t)(A->nb) + (size_t)(A->nb) + 1 +
+                (size_t)(A->mp) * (size_t)(A->nb);
+   CKPT->len  = CKPT->hlen + sizeof( double ) *
+                ( (size_t)(A->ld) * (size_t)(A->nq) +
+                  (size_t)(ALGO->depth) * CKPT->plen );
+
+   CKPT->name = (char *)malloc( strlen( ALGO->ckptf ) + 16 );
+   if( CKPT->name == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdckpt_open", "Memory allocation failed" ); }
+   (void) sprintf( CKPT->name, "%s.%d", ALGO->ckptf, GRID->iam );
+
+/*
+ * End of HPL_pdckpt_open
+ */
+}
@@ -0,0 +1,180 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <sys/mman.h>
+
+#ifdef STDC_HEADERS
+void HPL_pdckpt_save
+(
+   HPL_T_ckpt *                     CKPT,
+   HPL_T_pmat *                     A,
+   HPL_T_panel * *                  PANEL,
+   const int *                      STATE
+)
+#else
+void HPL_pdckpt_save
+( CKPT, A, PANEL, STATE )
+   HPL_T_ckpt *                     CKPT;
+   HPL_T_pmat *                     A;
+   HPL_T_panel * *                  PANEL;
+   const int *                      STATE;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdckpt_save takes a checkpoint of the factorization at the top of
+ * an iteration of  HPL_pdgesvK2,  when the look-ahead panels have been
+ * factored and broadcast. The local array,  the factors and pivots of
+ * the look-ahead panels, and the loop state are copied into the mapped
+ * checkpoint  slot  that does not hold the previous checkpoint,  which
+ * therefore remains valid until this one  is on disk.  The local co-
+ * lumns of A left of the jj of the checkpoint  the slot last held are
+ * final, L being left unpivoted, and are not copied again.  The file is then
+ * flushed in the background by HPL_pdckpt_flush.  A flush still in
+ * flight is waited for first.
+ *
+ * Arguments
+ * =========
+ *
+ * CKPT    (local input/output)          HPL_T_ckpt *
+ *         On entry,  CKPT  points to the checkpoint descriptor.
+ *
+ * A       (local input)                 HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information.
+ *
+ * PANEL   (local input)                 HPL_T_panel * *
+ *         On entry,  PANEL  is  the list of the CKPT->depth  look-ahead
+ *         panels.
+ *
+ * STATE   (local input)                 const int *
+ *         On entry,  STATE  is an array of dimension  HPL_CKPT_NSTATE
+ *         holding the loop state of HPL_pdgesvK2.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_panel                * p;
+   double                     * rec;
+   int                        * head, * meta;
+   size_t                     la, lj;
+   double                     time;
+   int                        i, jb, k, ml2, slot;
+/* ..
+ * .. Executable Statements ..
+ */
+   time = HPL_timer_walltime();
+#ifdef HPL_USE_PTHREADS
+   if( CKPT->busy ) (void) pthread_join( CKPT->thread, NULL );
+#endif
+   CKPT->busy = 0;
+/*
+ * Invalidate the slot first: its header must not describe a checkpoint
+ * that is being overwritten.
+ */
+   slot = ( CKPT->seq + 1 ) & 1;
+   HPL_pdckpt_map( CKPT, slot );
+   head = (int *)(CKPT->map[slot]);
+   head[HPL_CKPT_VALID] = 0;
+   (void) msync( (void *)head, CKPT->hlen, MS_SYNC );
+
+   head[HPL_CKPT_SEQ] = CKPT->seq + 1;
+   for( i = 0; i < HPL_CKPT_NKEY;   i++ ) head[HPL_CKPT_KEY+i]   = CKPT->key[i];
+   for( i = 0; i < HPL_CKPT_NSTATE; i++ ) head[HPL_CKPT_STATE+i] = STATE[i];
+
+   la  = (size_t)(A->ld) * (size_t)(A->nq);
+   lj  = (size_t)(A->ld) * (size_t)(CKPT->jjs[slot]);
+   rec = (double *)( (char *)(head) + CKPT->hlen );
+   (void) memcpy( (void *)(rec + lj), (const void *)(A->A + lj),
+                  ( la - lj ) * sizeof( double ) );
+   CKPT->nbyte += (double)(CKPT->hlen + ( la - lj ) * sizeof( double ));
+   CKPT->jjs[slot] = STATE[2];
+/*
+ * Panel records: L1, DPIV and DINFO are contiguous.  L2 is saved  only
+ * when it does not live in A.
+ */
+   for( k = 0, rec += la; k < CKPT->depth; k++, rec += CKPT->plen )
+   {
+      p    = PANEL[k]; jb = p->jb;
+      meta = head + HPL_CKPT_PANEL + HPL_CKPT_NPANEL * k;
+      meta[0] = p->ia; meta[1] = jb;    meta[2] = p->ja;
+      meta[3] = p->nq; meta[4] = p->jj; meta[5] = p->msgid;
+
+      (void) memcpy( (void *)rec, (const void *)(p->L1),
+                     (size_t)(jb * jb + jb + 1) * sizeof( double ) );
+      CKPT->nbyte += (double)(jb * jb + jb + 1) * sizeof( double );
+#ifndef HPL_COPY_L
+      if( p->grid->mycol == p->pcol ) continue;
+#endif
+      ml2 = p->mp - ( p->grid->myrow == p->prow ? jb : 0 );
+      ml2 = Mmax( 0, ml2 );
+      HPL_dlacpy( ml2, jb, p->L2, p->ldl2, rec + jb * jb + jb + 1,
+                  Mmax( 1, ml2 ) );
+      CKPT->nbyte += (double)(ml2) * (double)(jb) * sizeof( double );
+   }
+   CKPT->seq++; CKPT->nckpt++;
+   CKPT->tsnap += HPL_timer_walltime() - time;
+/*
+ * Flush it in the background
+ */
+#ifdef HPL_USE_PTHREADS
+   if( HPL_thrd &&
+       ( pthread_create( &(CKPT->thread), NULL, HPL_pdckpt_flush,
+                         (void *)(CKPT) ) == 0 ) ) { CKPT->busy = 1; return; }
+#endif
+   (void) HPL_pdckpt_flush( (void *)(CKPT) );
+/*
+ * End of HPL_pdckpt_save
+ */
+}
@@ -0,0 +1,230 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+/*
+ * The statistics of the single precision broadcast and refinement  of
+ * the last solve of this process
+ */
+HPL_T_mxst                          HPL_mxst;
+
+#ifdef STDC_HEADERS
+static double HPL_pdgerfs_norm
+(
+   HPL_T_grid *                     GRID,
+   const int                        ICURCOL,
+   const int                        M,
+   const double *                   V
+)
+#else
+static double HPL_pdgerfs_norm( GRID, ICURCOL, M, V )
+   HPL_T_grid *                     GRID;
+   const int                        ICURCOL;
+   const int                        M;
+   const double *                   V;
+#endif
+{
+/*
+ * Return in every process the infinity norm of the column vector V of
+ * local length M distributed in the process column ICURCOL.
+ */
+   double                     vnorm = HPL_rzero;
+
+   if( GRID->mycol == ICURCOL )
+   {
+      if( M > 0 ) { vnorm = V[HPL_idamax( M, V, 1 )]; vnorm = Mabs( vnorm ); }
+      (void) HPL_all_reduce( (void *)(&vnorm), 1, HPL_DOUBLE, HPL_max,
+                             GRID->col_comm );
+   }
+   (void) HPL_broadcast( (void *)(&vnorm), 1, HPL_DOUBLE, ICURCOL,
+                         GRID->row_comm );
+   return( vnorm );
+}
+
+#ifdef STDC_HEADERS
+void HPL_pdgerfs
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A
+)
+#else
+void HPL_pdgerfs
+( GRID, ALGO, A )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdgerfs  improves  the solution  x  of  the  system  factored and
+ * solved by  HPL_pdgesv  by iterative refinement.  It is used when the
+ * panels have been broadcast in single precision,  that limits the ac-
+ * curacy of the factors to single precision.  In every step, the resi-
+ * dual  r = b - A x  is computed in double precision with the copy A->A0
+ * of [A|b],  the system  A d = r is solved with the factors,  and d is
+ * added to x.  To solve with the factors,  HPL_pdtrsmL  applies the
+ * pivots and L to r put in the column N+1 of A, as the factorization
+ * did to b,  before  HPL_pdtrsv.  The refinement stops after HPL_NREF_-
+ * MAX steps, when the scaled residual
+ * ||r||_oo / ( eps * ( ||A||_oo * ||x||_oo + ||b||_oo ) * N )
+ * is below 1,  or when it no longer halves.  A step that increases the
+ * residual is undone,  so that x is the best solution computed.  The
+ * statistics, the residual of the x returned included,  are kept in
+ * HPL_mxst.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input/output)          HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information,  the factors and the solution  returned by
+ *         HPL_pdgesv. On exit, A->X is the refined solution.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   double                     * A0, * B, * B0, * W, * XS, * work;
+   double                     anorm, bnorm, eps, resid, rprev=HPL_rzero,
+                              time, xnorm;
+   int                        N, i, icurcol, ld, mp, mycol, nb, nq,
+                              nq1;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( ( N = A->n ) <= 0 ) || ( A->A0 == NULL ) ) return;
+
+   time = HPL_timer_walltime(); mycol = GRID->mycol;
+   nb = A->nb; ld = A->ld; mp = A->mp; A0 = A->A0;
+   nq  = HPL_numroc( N,   nb, nb, mycol, 0, GRID->npcol );
+   nq1 = HPL_numroc( N+1, nb, nb, mycol, 0, GRID->npcol );
+   icurcol = HPL_indxg2p( N, nb, nb, 0, GRID->npcol );
+   B = Mptr( A->A, 0, nq, ld ); B0 = Mptr( A0, 0, nq, ld );
+
+   work = (double *)malloc( (size_t)( Mmax( 1, mp + nq ) ) *
+                            sizeof( double ) );
+   if( work == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdgerfs", "Memory allocation failed" ); }
+   W = work; XS = work + mp;
+
+   eps   = HPL_pdlamch( GRID->all_comm, HPL_MACH_EPS );
+   anorm = HPL_pdlange( GRID, HPL_NORM_I, N, N, nb, A0, ld );
+   bnorm = HPL_pdgerfs_norm( GRID, icurcol, mp, B0 );
+
+   for( HPL_mxst.nstep = 0; ; HPL_mxst.nstep++ )
+   {
+/*
+ * r = b - A x, reduced in the process column owning the column N+1
+ */
+      if( mycol == icurcol )
+      {
+         for( i = 0; i < mp; i++ ) W[i] = B0[i];
+         HPL_dgemv( HplColumnMajor, HplNoTrans, mp, nq, -HPL_rone, A0, ld,
+                    A->X, 1, HPL_rone, W, 1 );
+      }
+      else if( nq > 0 )
+      {
+         HPL_dgemv( HplColumnMajor, HplNoTrans, mp, nq, -HPL_rone, A0, ld,
+                    A->X, 1, HPL_rzero, W, 1 );
+      }
+      else { for( i = 0; i < mp; i++ ) W[i] = HPL_rzero; }
+
+      if( mp > 0 )
+         (void) HPL_reduce( W, mp, HPL_DOUBLE, HPL_sum, icurcol,
+                            GRID->row_comm );
+      if( mycol == icurcol ) { for( i = 0; i < mp; i++ ) B[i] = W[i]; }
+/*
+ * Because x is distributed in process rows, switch the norms
+ */
+      xnorm = HPL_pdlange( GRID, HPL_NORM_1, 1, N, nb, A->X, 1 );
+      resid = HPL_pdgerfs_norm( GRID, icurcol, mp, W ) /
+              ( eps * ( anorm * xnorm + bnorm ) * (double)(N) );
+
+      if( HPL_mxst.nstep == 0 ) HPL_mxst.rnrm0 = resid;
+      else if( resid > rprev )
+      {
+/*
+ * The last correction made x worse: go back to the previous one
+ */
+         for( i = 0; i < nq; i++ ) A->X[i] = XS[i];
+         resid = rprev; HPL_mxst.nstep--; break;
+      }
+      else if( resid > 0.5 * rprev ) break;
+      if( ( HPL_mxst.nstep == HPL_NREF_MAX ) || ( resid <= HPL_rone ) )
+         break;
+      rprev = resid;
+/*
+ * Apply the pivots and L to r,  solve with U into A->X
+ */
+      HPL_pdtrsmL( GRID, ALGO, A, nq1 - nq, B );
+      for( i = 0; i < nq; i++ ) XS[i] = A->X[i];
+      HPL_pdtrsv( GRID, A );
+      for( i = 0; i < nq; i++ ) A->X[i] += XS[i];
+   }
+   HPL_mxst.rnrm1 = resid;
+
+   if( work ) free( work );
+   HPL_mxst.tref = HPL_timer_walltime() - time;
+/*
+ * End of HPL_pdgerfs
+ */
+}
@@ -72,7 +72,18 @@ void HPL_pdgesv
  * partial pivoting.  The main algorithm  is the "right looking" variant
  * with  or  without look-ahead.  The  lower  triangular  factor is left
  * unpivoted and the pivots are not returned. The right hand side is the
- * N+1 column of the coefficient matrix.
+ * N+1 column of the coefficient matrix.  When ALGO->ooc is positive,
+ * the local array does not fit in memory and  the factorization is
+ * performed slab by slab by the out-of-core variant HPL_pdgesvO. Other-
+ * wise, when ALGO->engine is HPL_ENG_DAG, the factorization is perfor-
+ * med by the task graph variant HPL_pdgesvD.  Otherwise,  on a P-by-1
+ * process grid, when more than one thread per process is requested,
+ * the factorization is performed by the multi-threaded task-based
+ * variant HPL_pdgesvS when P is 1, and by HPL_pdgesvD otherwise.  Only
+ * the look-ahead variant HPL_pdgesvK2 takes and resumes from checkpoints,
+ * see ALGO->ckpt; the statistics of the last factorization are kept in
+ * HPL_ckst.  When A->A0 is not NULL, the solution is then refined by
+ * HPL_pdgerfs.
  *
  * Arguments
  * =========
@@ -97,7 +108,28 @@ void HPL_pdgesv
    if( A->n <= 0 ) return;
 
    A->info = 0;
+   HPL_ckst.nbyte = HPL_ckst.tsnap = HPL_ckst.tflush = HPL_rzero;
+   HPL_ckst.nckpt = 0; HPL_ckst.jrst = -1;
+   HPL_mxst.nbyte = HPL_mxst.nsave = HPL_mxst.tref = HPL_rzero;
+   HPL_mxst.rnrm0 = HPL_mxst.rnrm1 = HPL_rzero; HPL_mxst.nstep = -1;
 
+   if( ALGO->ooc > 0 )
+   {
+      HPL_pdgesvO(  GRID, ALGO, A );
+   }
+   else
+#ifdef HPL_USE_PTHREADS
+   if( ALGO->engine == HPL_ENG_DAG )
+   {
+      HPL_pdgesvD(  GRID, ALGO, A );
+   }
+   else if( ( GRID->npcol == 1 ) && ( ALGO->nthrd > 1 ) )
+   {
+      if( GRID->nprow == 1 ) HPL_pdgesvS( GRID, ALGO, A );
+      else                   HPL_pdgesvD( GRID, ALGO, A );
+   }
+   else
+#endif
    if( ( ALGO->depth == 0 ) || ( GRID->npcol == 1 ) )
    {
       HPL_pdgesv0(  GRID, ALGO, A );
@@ -110,6 +142,10 @@ void HPL_pdgesv
  * Solve upper triangular system
  */
    if( A->info == 0 ) HPL_pdtrsv( GRID, A );
+/*
+ * Refine the solution
+ */
+   if( ( A->info == 0 ) && ( A->A0 != NULL ) ) HPL_pdgerfs( GRID, ALGO, A );
 /*
  * End of HPL_pdgesv
  */
@@ -0,0 +1,539 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+/*
+ * Operands shared by the tasks of the factorization graph
+ */
+typedef struct HPL_S_pdgesvD
+{
+   HPL_T_grid                 * grid;
+   HPL_T_palg                 * algo;
+   HPL_T_pmat                 * pmat;
+   HPL_T_panel                * * panel;
+   int                        l1notran;
+   int                        unotran;
+   int                        nq;
+   int                        tag;
+} HPL_T_pdgesvD;
+/*
+ * Position of the tasks of panel k in the graph
+ */
+#define    TF( k_ )        ( tasks + off[(k_)]     )
+#define    TB( k_ )        ( tasks + off[(k_)] + 1 )
+#define    TR( k_ )        ( tasks + off[(k_)] + 2 )
+#define    TW( k_, l_ )    ( tasks + off[(k_)] + 3 + \
+                             ( (l_) - tl0[(k_)] ) * ( nw + 1 ) )
+#define    TU( k_, l_ )    ( TW( k_, l_ ) + nw )
+
+#ifdef STDC_HEADERS
+static void HPL_pdgesvD_tile
+(
+   HPL_T_pdgesvD *                  S,
+   const int                        K,
+   const int                        L,
+   int *                            C0,
+   int *                            C1
+)
+#else
+static void HPL_pdgesvD_tile( S, K, L, C0, C1 )
+   HPL_T_pdgesvD *                  S;
+   const int                        K;
+   const int                        L;
+   int *                            C0;
+   int *                            C1;
+#endif
+{
+/*
+ * Return in [C0,C1) the local columns of the L-th local column block of
+ * A that are updated by the panel K.  This range is empty when the glo-
+ * bal column block precedes the panel,  and reduced to the columns  on
+ * the right of the panel when the last panel shares its block with the
+ * right hand side.
+ */
+   int                        g, nb;
+
+   nb  = S->pmat->nb;
+   g   = L * S->grid->npcol + S->grid->mycol;
+   *C0 = L * nb; *C1 = Mmin( S->nq, *C0 + nb );
+
+   if(      g <  K ) { *C1 = *C0; }
+   else if( g == K ) { *C0 += Mmin( S->pmat->n - K * nb, nb ); }
+   if( *C1 < *C0 ) *C1 = *C0;
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvD_fact
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvD_fact( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Allocate the panel TASK->i,  factor it in the process column owning
+ * it and start its broadcast along the process rows.
+ */
+   HPL_T_pdgesvD              * S = (HPL_T_pdgesvD *)(TASK->arg);
+   HPL_T_panel                * p;
+   int                        j, jb, n;
+
+   j = TASK->i * S->pmat->nb; n = S->pmat->n - j;
+   jb = Mmin( n, S->pmat->nb );
+
+   HPL_pdpanel_new( S->grid, S->algo, n, n+1, jb, S->pmat, j, j, S->tag,
+                    &(S->panel[TASK->i]) );
+   S->tag = MNxtMgid( S->tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
+
+   p = S->panel[TASK->i];
+   HPL_pdfact( p );
+   (void) HPL_binit( p );
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvD_bcst
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvD_bcst( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Probe for the panel TASK->i and forward it.  Return HPL_KEEP_TESTING
+ * while the panel has not been received,  so that the master thread can
+ * work on something else meanwhile.  On a single process row, the local
+ * pivot offsets used by HPL_dlaswp00N are computed once all here.  L2 is
+ * also packed here, before the update tasks sharing it are released.
+ */
+   HPL_T_pdgesvD              * S = (HPL_T_pdgesvD *)(TASK->arg);
+   HPL_T_panel                * p = S->panel[TASK->i];
+   int                        i, test = HPL_KEEP_TESTING;
+
+   (void) HPL_bcast( p, &test );
+   if( test != HPL_SUCCESS ) return( HPL_KEEP_TESTING );
+   (void) HPL_bwait( p );
+
+   if( S->grid->nprow == 1 )
+   {
+      for( i = 0; i < p->jb; i++ )
+         p->IWORK[i] = (int)(p->DPIV[i]) - p->ii;
+   }
+   HPL_pdpanel_pack( p );
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvD_swap
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvD_swap( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Apply the row interchanges of the panel TASK->i  to the column block
+ * TASK->j and broadcast the corresponding rows of U  within the process
+ * column.  The swapping routines operate on a copy of the panel  struc-
+ * ture narrowed down to this block and to its own slice of U.
+ */
+   HPL_T_pdgesvD              * S = (HPL_T_pdgesvD *)(TASK->arg);
+   HPL_T_panel                * p = S->panel[TASK->i];
+   HPL_T_panel                v;
+   HPL_T_SWAP                 fswap;
+   int                        c0, c1, nn, test = HPL_SUCCESS;
+
+   HPL_pdgesvD_tile( S, TASK->i, TASK->j, &c0, &c1 ); nn = c1 - c0;
+
+   v = *p; v.n = v.nq = nn; v.jj = c0;
+   v.A = Mptr( S->pmat->A, p->ii, c0, p->lda );
+   v.U = p->U + (size_t)(c0 - p->jj) * (size_t)(p->jb);
+/*
+ * The swapping algorithm is selected from the width of the whole trai-
+ * ling submatrix, as in HPL_pdupdate.
+ */
+   fswap = S->algo->fswap;
+   if( (   fswap == HPL_SWAP01 ) ||
+       ( ( fswap == HPL_SW_MIX ) && ( p->nq > S->algo->fsthr ) ) )
+   {
+      if( S->unotran ) HPL_pdlaswp01N( NULL, &test, &v, nn );
+      else             HPL_pdlaswp01T( NULL, &test, &v, nn );
+   }
+   else
+   {
+      if( S->unotran ) HPL_pdlaswp00N( NULL, &test, &v, nn );
+      else             HPL_pdlaswp00T( NULL, &test, &v, nn );
+   }
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvD_updt
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvD_updt( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Update the column block TASK->j with the panel TASK->i: solve for the
+ * rows of U and apply the rank-jb update to the rows below.
+ */
+   HPL_T_pdgesvD              * S = (HPL_T_pdgesvD *)(TASK->arg);
+   HPL_T_panel                * p = S->panel[TASK->i];
+   double                     * Aptr, * Cptr, * Uptr;
+   int                        c0, c1, curr, jb, lda, mp, nn;
+
+   HPL_pdgesvD_tile( S, TASK->i, TASK->j, &c0, &c1 ); nn = c1 - c0;
+   jb = p->jb; lda = p->lda;
+   Aptr = Mptr( S->pmat->A, p->ii, c0, lda );
+
+   if( S->grid->nprow == 1 )
+   {
+      mp = p->mp - jb;
+      HPL_dlaswp00N( jb, nn, Aptr, lda, p->IWORK );
+      if( S->l1notran )
+         HPL_dtrsm( HplColumnMajor, HplLeft, HplLower, HplNoTrans,
+                    HplUnit, jb, nn, HPL_rone, p->L1, jb, Aptr, lda );
+      else
+         HPL_dtrsm( HplColumnMajor, HplLeft, HplUpper, HplTrans,
+                    HplUnit, jb, nn, HPL_rone, p->L1, jb, Aptr, lda );
+      HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, p->L2P, p->L2,
+                   p->ldl2, Aptr, lda, HPL_rone,
+                   Mptr( Aptr, jb, 0, lda ), lda );
+      return( HPL_SUCCESS );
+   }
+
+   curr = ( S->grid->myrow == p->prow ? 1 : 0 );
+   mp   = p->mp - ( curr != 0 ? jb : 0 );
+   Cptr = ( curr != 0 ? Mptr( Aptr, jb, 0, lda ) : Aptr );
+   Uptr = p->U + (size_t)(c0 - p->jj) * (size_t)(jb);
+
+   if( S->unotran )                       /* U is jb x nn, LDU = jb */
+   {
+      if( S->l1notran )
+         HPL_dtrsm( HplColumnMajor, HplLeft, HplLower, HplNoTrans,
+                    HplUnit, jb, nn, HPL_rone, p->L1, jb, Uptr, jb );
+      else
+         HPL_dtrsm( HplColumnMajor, HplLeft, HplUpper, HplTrans,
+                    HplUnit, jb, nn, HPL_rone, p->L1, jb, Uptr, jb );
+      HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, p->L2P, p->L2,
+                   p->ldl2, Uptr, jb, HPL_rone, Cptr, lda );
+      if( curr != 0 ) HPL_dlacpy( jb, nn, Uptr, jb, Aptr, lda );
+   }
+   else                                   /* U is nn x jb, LDU = nn */
+   {
+      if( S->l1notran )
+         HPL_dtrsm( HplColumnMajor, HplRight, HplLower, HplTrans,
+                    HplUnit, nn, jb, HPL_rone, p->L1, jb, Uptr, nn );
+      else
+         HPL_dtrsm( HplColumnMajor, HplRight, HplUpper, HplNoTrans,
+                    HplUnit, nn, jb, HPL_rone, p->L1, jb, Uptr, nn );
+      HPL_dgemmpk( HplTrans, mp, nn, jb, -HPL_rone, p->L2P, p->L2,
+                   p->ldl2, Uptr, nn, HPL_rone, Cptr, lda );
+      if( curr != 0 ) HPL_dlatcpy( jb, nn, Uptr, nn, Aptr, lda );
+   }
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvD_free
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvD_free( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Release the panel TASK->i once all the updates using it are done.
+ */
+   HPL_T_pdgesvD              * S = (HPL_T_pdgesvD *)(TASK->arg);
+
+   (void) HPL_pdpanel_disp( &(S->panel[TASK->i]) );
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+void HPL_pdgesvD
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A
+)
+#else
+void HPL_pdgesvD
+( GRID, ALGO, A )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdgesvD factors a N+1-by-N matrix using LU factorization with row
+ * partial pivoting.  Instead of the hand-scheduled pipeline  of  HPL_-
+ * pdgesvK2,  the factorization is expressed as a graph of tasks opera-
+ * ting on the local column blocks of A.  For every panel k,  each pro-
+ * cess owns:
+ *
+ *    F(k)    the allocation and factorization of the panel,  and  the
+ *            start of its broadcast along the process row,
+ *    B(k)    the completion of this broadcast,
+ *    W(k,l)  the row interchanges and the broadcast of U in the column
+ *            block l (only when P > 1),
+ *    U(k,l)  the triangular solve and the rank-jb update of  the column
+ *            block l,
+ *    R(k)    the release of the panel.
+ *
+ * The graph is executed by a work-stealing pool of ALGO->nthrd threads.
+ * The tasks calling MPI are executed by the master thread only,  in the
+ * same order on all processes; a broadcast in progress is polled by the
+ * master thread in between other tasks.  The panel k+1 is factored  as
+ * soon as its column block has been updated by the panel k,  the look-
+ * ahead is thus dynamic and  ALGO->depth  is ignored.  At  most  three
+ * panels are in flight.  The lower triangular factor is left unpivoted
+ * and the pivots are not returned.  The right hand side is the N+1 co-
+ * lumn of the coefficient matrix.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input/output)          HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_pdgesvD              S;
+   HPL_T_tpool                pool;
+   HPL_T_task                 * t, * u, * tasks = NULL;
+   HPL_T_task                 * * succ = NULL, * * sp;
+   int                        * off = NULL, * tl0 = NULL;
+   int                        N, c0, c1, k, kt, l, la, mycol, nb, nlb,
+                              npcol, ntask, nw, seq;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( N = A->n ) <= 0 ) return;
+
+   nb    = A->nb;          kt    = ( N + nb - 1 ) / nb;
+   npcol = GRID->npcol;    mycol = GRID->mycol;
+   nw    = ( GRID->nprow > 1 ? 1 : 0 );
+/*
+ * Local number of columns of [A,b] - A->nq has room for b everywhere
+ */
+   S.nq  = HPL_numroc( N+1, nb, nb, mycol, 0, npcol );
+   nlb   = ( S.nq + nb - 1 ) / nb;
+
+   S.grid = GRID; S.algo = ALGO; S.pmat = A; S.tag = MSGID_BEGIN_FACT;
+   S.l1notran = ( ( ALGO->upfun == HPL_pdupdateNN ) ||
+                  ( ALGO->upfun == HPL_pdupdateNT ) );
+   S.unotran  = ( ( ALGO->upfun == HPL_pdupdateNN ) ||
+                  ( ALGO->upfun == HPL_pdupdateTN ) );
+/*
+ * For each panel k,  tl0[k] is the first local column block updated by
+ * k.  Tasks are stored panel by panel: F(k), B(k), R(k), followed by
+ * W(k,l) and U(k,l) for l = tl0[k] .. nlb-1.
+ */
+   off     = (int *)malloc( (size_t)(kt+1) * sizeof( int ) );
+   tl0     = (int *)malloc( (size_t)(kt+1) * sizeof( int ) );
+   S.panel = (HPL_T_panel **)malloc( (size_t)(kt) *
+                                     sizeof( HPL_T_panel * ) );
+   if( ( off == NULL ) || ( tl0 == NULL ) || ( S.panel == NULL ) )
+   { HPL_pabort( __LINE__, "HPL_pdgesvD", "Memory allocation failed" ); }
+
+   for( k = 0, off[0] = 0; k < kt; k++ )
+   {
+      for( l = 0; l < nlb; l++ )
+      {
+         HPL_pdgesvD_tile( &S, k, l, &c0, &c1 );
+         if( c1 > c0 ) break;
+      }
+      tl0[k] = l; S.panel[k] = NULL;
+      off[k+1] = off[k] + 3 + ( nlb - l ) * ( nw + 1 );
+   }
+   tl0[kt] = nlb; ntask = off[kt];
+
+   tasks = (HPL_T_task  *)malloc( (size_t)(ntask) *
+                                  sizeof( HPL_T_task ) );
+   succ  = (HPL_T_task **)malloc( (size_t)(3*ntask) *
+                                  sizeof( HPL_T_task * ) );
+   if( ( tasks == NULL ) || ( succ == NULL ) )
+   { HPL_pabort( __LINE__, "HPL_pdgesvD", "Memory allocation failed" ); }
+
+   for( k = 0; k < ntask; k++ )
+   {
+      t = tasks + k; t->arg = (void *)(&S); t->next = t->prev = NULL;
+      t->i = t->j = 0; t->nsucc = 0; t->mastr = 0; t->seqno = -1;
+      t->prior = 0;
+   }
+/*
+ * Build the graph - the task bodies and dependency counts first
+ */
+   for( k = 0; k < kt; k++ )
+   {
+      t = TF( k ); t->fun = HPL_pdgesvD_fact; t->i = k;
+      t->mastr = 1; t->prior = 1;
+      t->ndep  = ( k >= 2 ? 1 : 0 ) +
+                 ( ( k > 0 ) && ( k % npcol == mycol ) ? 1 : 0 );
+
+      t = TB( k ); t->fun = HPL_pdgesvD_bcst; t->i = k;
+      t->mastr = 1; t->prior = 1; t->ndep = 1;
+
+      t = TR( k ); t->fun = HPL_pdgesvD_free; t->i = k;
+      t->ndep  = 1 + nlb - tl0[k];
+
+      for( l = tl0[k]; l < nlb; l++ )
+      {
+         u = TU( k, l ); u->fun = HPL_pdgesvD_updt; u->i = k; u->j = l;
+         if( nw )
+         {
+            t = TW( k, l ); t->fun = HPL_pdgesvD_swap;
+            t->i = k; t->j = l; t->mastr = 1;
+            t->ndep = 1 + ( k > 0 ? 1 : 0 ); u->ndep = 1;
+         }
+         else { u->ndep = 1 + ( k > 0 ? 1 : 0 ); }
+      }
+   }
+/*
+ * then the successor lists.  la is the local column block holding the
+ * panel k+1, if any: its update by the panel k is on the critical path.
+ */
+   for( k = 0, sp = succ; k < kt; k++ )
+   {
+      la = ( ( k + 1 < kt ) && ( ( k + 1 ) % npcol == mycol ) ?
+             ( k + 1 ) / npcol : -1 );
+
+      t = TF( k ); t->succ = sp; *sp++ = TB( k ); t->nsucc = 1;
+
+      t = TB( k ); t->succ = sp;
+      for( l = tl0[k]; l < nlb; l++ ) *sp++ = TW( k, l );
+      *sp++ = TR( k ); t->nsucc = nlb - tl0[k] + 1;
+
+      t = TR( k ); t->succ = sp;
+      if( k + 2 < kt ) { *sp++ = TF( k+2 ); t->nsucc = 1; }
+
+      for( l = tl0[k]; l < nlb; l++ )
+      {
+         u = TU( k, l );
+         if( nw )
+         {
+            t = TW( k, l ); t->succ = sp; *sp++ = u; t->nsucc = 1;
+            t->prior = ( l == la );
+         }
+         u->succ = sp; u->prior = ( l == la );
+         *sp++ = TR( k ); u->nsucc = 1;
+         if( ( k + 1 < kt ) && ( l >= tl0[k+1] ) )
+         { *sp++ = TW( k+1, l ); u->nsucc++; }
+         if( l == la ) { *sp++ = TF( k+1 ); u->nsucc++; }
+      }
+   }
+/*
+ * Number the master-only tasks in the order of HPL_pdgesvK1 with  a
+ * look-ahead of depth one: the swaps of the column block holding the
+ * next panel,  the factorization of the next panel,  then  the  other
+ * swaps.
+ */
+   seq = 0; TF( 0 )->seqno = seq++; TB( 0 )->seqno = seq++;
+   for( k = 0; k < kt; k++ )
+   {
+      la = ( ( k + 1 < kt ) && ( ( k + 1 ) % npcol == mycol ) ?
+             ( k + 1 ) / npcol : -1 );
+      if( nw && ( la >= 0 ) ) TW( k, la )->seqno = seq++;
+      if( k + 1 < kt )
+      { TF( k+1 )->seqno = seq++; TB( k+1 )->seqno = seq++; }
+      if( nw )
+      {
+         for( l = tl0[k]; l < nlb; l++ )
+         { if( l != la ) TW( k, l )->seqno = seq++; }
+      }
+   }
+/*
+ * Execute the graph - release the work arrays
+ */
+   HPL_tpool_init( &pool, ALGO->nthrd );
+   HPL_tpool_run(  &pool, tasks, ntask );
+   HPL_tpool_exit( &pool );
+
+   if( succ    ) free( succ    );
+   if( tasks   ) free( tasks   );
+   if( S.panel ) free( S.panel );
+   if( tl0     ) free( tl0     );
+   if( off     ) free( off     );
+/*
+ * End of HPL_pdgesvD
+ */
+}
+
+#endif
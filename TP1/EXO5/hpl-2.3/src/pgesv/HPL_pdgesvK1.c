@@ -97,7 +97,7 @@ void HPL_pdgesvK1
    HPL_T_panel                * * panel = NULL;
    HPL_T_UPD_FUN              HPL_pdupdate;
    int                        N, depth, icurcol=0, j, jb, jj=0, jstart,
-                              k, mycol, n, nb, nn, npcol, nq,
+                              k, mycol, n, nb, nn, nq,
                               tag=MSGID_BEGIN_FACT, test=HPL_KEEP_TESTING;
 #ifdef HPL_PROGRESS_REPORT
    double start_time, time, gflops;
@@ -105,7 +105,7 @@ void HPL_pdgesvK1
 /* ..
  * .. Executable Statements ..
  */
-   mycol = GRID->mycol; npcol        = GRID->npcol;
+   mycol = GRID->mycol;
    depth = ALGO->depth; HPL_pdupdate = ALGO->upfun;
    N     = A->n;        nb           = A->nb; 
 
@@ -124,7 +124,8 @@ void HPL_pdgesvK1
 /*
  * Create and initialize the first depth panels
  */
-   nq = HPL_numroc( N+1, nb, nb, mycol, 0, npcol ); nn = N; jstart = 0;
+   nq = HPL_numrocW( N+1, 0, nb, mycol, GRID ); nn = N; jstart = 0;
+   icurcol = HPL_indxg2pW( 0, nb, GRID );
 
    for( k = 0; k < depth; k++ )
    {
@@ -133,7 +134,7 @@ void HPL_pdgesvK1
                        tag, &panel[k] );
       nn -= jb; jstart += jb;
       if( mycol == icurcol ) { jj += jb; nq -= jb; }
-      icurcol = MModAdd1( icurcol, npcol );
+      icurcol = HPL_indxg2pW( jstart, nb, GRID );
       tag     = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
    }
 /*
@@ -156,7 +157,7 @@ void HPL_pdgesvK1
  */
       if( k < depth - 1 )
       {
-         nn = HPL_numrocI( jstart-j, j, nb, nb, mycol, 0, npcol );
+         nn = HPL_numrocW( jstart-j, j, nb, mycol, GRID );
          HPL_pdupdate( NULL, NULL, panel[k], nn );
       }
    }
@@ -183,7 +184,7 @@ void HPL_pdgesvK1
  
       if( mycol == icurcol )
       {
-         nn = HPL_numrocI( jb, j, nb, nb, mycol, 0, npcol );
+         nn = HPL_numrocW( jb, j, nb, mycol, GRID );
          for( k = 0; k < depth; k++ )   /* partial updates 0..depth-1 */
             HPL_pdupdate( NULL, NULL, panel[k], nn );
          HPL_pdfact(    panel[depth] );       /* factor current panel */
@@ -202,13 +203,13 @@ void HPL_pdgesvK1
       for( k = 0; k < depth; k++ ) panel[k] = panel[k+1];
  
       if( mycol == icurcol ) { jj += jb; nq -= jb; }
-      icurcol = MModAdd1( icurcol, npcol );
+      icurcol = HPL_indxg2pW( j + jb, nb, GRID );
       tag     = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
    }
 /*
  * Clean-up: Finish updates - release panels and panel list
  */
-   nn = HPL_numrocI( 1, N, nb, nb, mycol, 0, npcol );
+   nn = HPL_numrocW( 1, N, nb, mycol, GRID );
    for( k = 0; k < depth; k++ )
    {
       HPL_pdupdate( NULL, NULL, panel[k], nn );
@@ -74,6 +74,13 @@ void HPL_pdgesvK2
  * the pivots are not returned. The right hand side is the N+1 column of
  * the coefficient matrix.
  *
+ * When ALGO->ckpt is positive,  a checkpoint is taken every ALGO->ckpt
+ * panels,  and the factorization is resumed from the last checkpoint
+ * left by an interrupted run with the same parameters, if any.  HPL_pd-
+ * info rejects checkpoints with L broadcast in single precision: the
+ * refinement needs the records A->R of all the panels,  that a resumed
+ * run would not have.
+ *
  * Arguments
  * =========
  *
@@ -94,20 +101,23 @@ void HPL_pdgesvK2
 /*
  * .. Local Variables ..
  */
+   HPL_T_ckpt                 ckpt;
    HPL_T_panel                * p, * * panel = NULL;
    HPL_T_UPD_FUN              HPL_pdupdate; 
-   int                        N, depth, icurcol=0, j, jb, jj=0, jstart,
-                              k, mycol, n, nb, nn, npcol, nq,
-                              tag=MSGID_BEGIN_FACT, test=HPL_KEEP_TESTING;
+   int                        N, depth, every, icurcol=0, j, jb, jj=0,
+                              jrst=-1, jstart, k, mycol, n, nb, nn, nq,
+                              tag=MSGID_BEGIN_FACT, test=HPL_KEEP_TESTING,
+                              state[HPL_CKPT_NSTATE];
 #ifdef HPL_PROGRESS_REPORT
    double start_time, time, gflops;
 #endif
 /* ..
  * .. Executable Statements ..
  */
-   mycol = GRID->mycol; npcol        = GRID->npcol;
+   mycol = GRID->mycol;
    depth = ALGO->depth; HPL_pdupdate = ALGO->upfun;
    N     = A->n;        nb           = A->nb;
+   every = ALGO->ckpt;
 
    if( N <= 0 ) return;
 
@@ -121,10 +131,27 @@ void HPL_pdgesvK2
    panel = (HPL_T_panel **)malloc( (size_t)(depth+1) * sizeof( HPL_T_panel *) );
    if( panel == NULL )
    { HPL_pabort( __LINE__, "HPL_pdgesvK2", "Memory allocation failed" ); }
+/*
+ * Resume from the last checkpoint: the look-ahead panels are restored
+ */
+   if( every > 0 )
+   {
+      HPL_pdckpt_open( &ckpt, GRID, ALGO, A );
+      if( HPL_pdckpt_load( &ckpt, GRID, ALGO, A, panel, state ) )
+      {
+         jrst = state[0]; icurcol = state[1]; jj = state[2];
+         nq   = state[3]; tag     = state[4]; A->info = state[5];
+         n    = N - jrst;
+         HPL_pdpanel_new( GRID, ALGO, n, n+1, Mmin( n, nb ), A, jrst,
+                          jrst, tag, &panel[depth] );
+         goto resume;
+      }
+   }
 /*
  * Create and initialize the first depth panels
  */
-   nq = HPL_numroc( N+1, nb, nb, mycol, 0, npcol ); nn = N; jstart = 0;
+   nq = HPL_numrocW( N+1, 0, nb, mycol, GRID ); nn = N; jstart = 0;
+   icurcol = HPL_indxg2pW( 0, nb, GRID );
 
    for( k = 0; k < depth; k++ )
    {
@@ -133,7 +160,7 @@ void HPL_pdgesvK2
                        tag, &panel[k] );
       nn -= jb; jstart += jb;
       if( mycol == icurcol ) { jj += jb; nq -= jb; }
-      icurcol = MModAdd1( icurcol, npcol );
+      icurcol = HPL_indxg2pW( jstart, nb, GRID );
       tag     = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
    }
 /*
@@ -162,16 +189,33 @@ void HPL_pdgesvK2
  */
       if( k < depth - 1 )
       {
-         nn = HPL_numrocI( jstart-j, j, nb, nb, mycol, 0, npcol );
+         nn = HPL_numrocW( jstart-j, j, nb, mycol, GRID );
          HPL_pdupdate( NULL, NULL, panel[k], nn );
       }
    }
+   jrst = jstart;
 /*
  * Main loop over the remaining columns of A
  */
-   for( j = jstart; j < N; j += nb )
+resume:
+   for( j = jrst; j < N; j += nb )
    {
       n = N - j; jb = Mmin( n, nb );
+/*
+ * Checkpoint the look-ahead pipeline every ckpt panels
+ */
+      if( ( every > 0 ) && ( j != jrst ) && ( ( j / nb ) % every == 0 ) )
+      {
+#ifdef HPL_DETAILED_TIMING
+         HPL_ptimer( HPL_TIMING_CKPT );
+#endif
+         state[0] = j;  state[1] = icurcol; state[2] = jj;
+         state[3] = nq; state[4] = tag;     state[5] = A->info;
+         HPL_pdckpt_save( &ckpt, A, panel, state );
+#ifdef HPL_DETAILED_TIMING
+         HPL_ptimer( HPL_TIMING_CKPT );
+#endif
+      }
 #ifdef HPL_PROGRESS_REPORT
       /* if this is process 0,0 and not the first panel */
       if ( GRID->myrow == 0 && mycol == 0 && j > 0 ) 
@@ -190,7 +234,7 @@ void HPL_pdgesvK2
 
       if( mycol == icurcol )
       {
-         nn = HPL_numrocI( jb, j, nb, nb, mycol, 0, npcol );
+         nn = HPL_numrocW( jb, j, nb, mycol, GRID );
          for( k = 0; k < depth; k++ )   /* partial updates 0..depth-1 */
             (void) HPL_pdupdate( NULL, NULL, panel[k], nn );
          HPL_pdfact(       panel[depth] );    /* factor current panel */
@@ -210,13 +254,13 @@ void HPL_pdgesvK2
       panel[depth] = p;
 
       if( mycol == icurcol ) { jj += jb; nq -= jb; }
-      icurcol = MModAdd1( icurcol, npcol );
+      icurcol = HPL_indxg2pW( j + jb, nb, GRID );
       tag     = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
    }
 /*
  * Clean-up: Finish updates - release panels and panel list
  */
-   nn = HPL_numrocI( 1, N, nb, nb, mycol, 0, npcol );
+   nn = HPL_numrocW( 1, N, nb, mycol, GRID );
    for( k = 0; k < depth; k++ )
    {
       (void) HPL_pdupdate( NULL, NULL, panel[k], nn );
@@ -225,6 +269,7 @@ void HPL_pdgesvK2
    (void) HPL_pdpanel_disp( &panel[depth] );
 
    if( panel ) free( panel );
+   if( every > 0 ) HPL_pdckpt_close( &ckpt, 1 );
 /*
  * End of HPL_pdgesvK2
  */
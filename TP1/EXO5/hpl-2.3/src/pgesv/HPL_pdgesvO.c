@@ -0,0 +1,259 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <unistd.h>
+#include <sys/mman.h>
+/*
+ * The out-of-core statistics of the last factorization of this process
+ */
+HPL_T_oost                          HPL_oost;
+
+#ifdef STDC_HEADERS
+static void HPL_pdgesvO_advise
+(
+   HPL_T_pmat *                     A,
+   const int                        JJ,
+   const int                        NN,
+   const int                        DROP
+)
+#else
+static void HPL_pdgesvO_advise( A, JJ, NN, DROP )
+   HPL_T_pmat *                     A;
+   const int                        JJ;
+   const int                        NN;
+   const int                        DROP;
+#endif
+{
+/*
+ * Start reading the local columns JJ:JJ+NN-1 of A from the file, or
+ * start writing them back and release their pages when DROP is set.
+ * These are hints only: the columns remain accessible in any case.
+ */
+   size_t                     beg, end, page;
+
+   if( NN <= 0 ) return;
+   page = (size_t)sysconf( _SC_PAGESIZE );
+   beg  = (size_t)( Mptr( A->A, 0, JJ,    A->ld ) );
+   end  = (size_t)( Mptr( A->A, 0, JJ+NN, A->ld ) );
+   beg -= beg % page; end += ( page - end % page ) % page;
+
+   if( DROP )
+   {
+      (void) msync(   (void *)beg, end - beg, MS_ASYNC      );
+      (void) madvise( (void *)beg, end - beg, MADV_DONTNEED );
+   }
+   else
+   {
+      (void) madvise( (void *)beg, end - beg, MADV_WILLNEED );
+   }
+}
+
+#ifdef STDC_HEADERS
+void HPL_pdgesvO
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A
+)
+#else
+void HPL_pdgesvO
+( GRID, ALGO, A )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdgesvO factors a N+1-by-N matrix using LU factorization with row
+ * partial pivoting when the local array does not fit in memory.  The
+ * columns of [A|b] are split into slabs  such that the local columns of
+ * two slabs fit in the memory window of ALGO->ooc MB per process.  The
+ * slabs are factored from left to right:  the panels of the previous
+ * slabs are read back from A and broadcast again to apply their  swaps
+ * and updates to the slab ("left-looking"),  then the slab is factored
+ * in-core with the right-looking algorithm of HPL_pdgesv0. While a slab
+ * is processed, the next one is read ahead and the previous one is
+ * written back in the background.  The panels of the previous slabs are
+ * replayed by HPL_pdreplay from A and the record A->R of their L1 fac-
+ * tors,  pivots and info scalars.  The lower triangular factor is left
+ * unpivoted and the pivots are not returned.
+ *
+ * A->A  must have been allocated by  HPL_pdooc_alloc with the same ALGO,
+ * since the pages written back are released  and only a shared file
+ * mapping keeps their contents.  A->R must not be NULL.  Statistics are
+ * kept in HPL_oost.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input/output)          HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_panel                * p = NULL;
+   HPL_T_UPD_FUN              HPL_pdupdate;
+   size_t                     colsz;
+   double                     time;
+   int                        N, c0, c1, cn, j, jb, jjl, jjn, jjs, mp, mycol,
+                              nb, nblk, nns, npcol, nq, ns,
+                              tag=MSGID_BEGIN_FACT, test=HPL_KEEP_TESTING;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( N = A->n ) <= 0 ) return;
+   if( A->R == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdgesvO", "No record of the panels" ); }
+
+   HPL_pdupdate = ALGO->upfun; nb = A->nb;
+   mycol = GRID->mycol; npcol = GRID->npcol;
+/*
+ * Slab width: a multiple of npcol blocks, the same in all processes
+ */
+   mp   = HPL_numroc( N, nb, nb, 0, 0, GRID->nprow ); mp = Mmax( 1, mp );
+   nblk = (int)( ( (size_t)(ALGO->ooc) << 20 ) /
+                 ( (size_t)2 * sizeof( double ) * (size_t)(mp) *
+                   (size_t)(nb) ) );
+   ns   = npcol * Mmax( 1, nblk ) * nb;
+   nq   = HPL_numroc( N+1, nb, nb, mycol, 0, npcol );
+
+   colsz = (size_t)(A->ld) * sizeof( double );
+   HPL_oost.rbyte = HPL_oost.wbyte = HPL_rzero;
+   HPL_oost.tleft = HPL_oost.tslab = HPL_rzero;
+   HPL_oost.nslab = 0; HPL_oost.width = ns;
+
+   HPL_pdpanel_new( GRID, ALGO, N, N+1, Mmin( N, nb ), A, 0, 0, tag, &p );
+/*
+ * Loop over the slabs [c0,c1) of A - the last one includes b
+ */
+   for( c0 = 0; c0 < N; c0 = c1 )
+   {
+      c1  = Mmin( c0 + ns, N ); cn = ( c1 == N ? N + 1 : c1 );
+      jjs = HPL_numroc( c0, nb, nb, mycol, 0, npcol );
+      jjn = HPL_numroc( cn, nb, nb, mycol, 0, npcol ); nns = jjn - jjs;
+/*
+ * Read the next slab ahead
+ */
+      j = Mmin( c1 + ns, N ); j = ( j == N ? N + 1 : j );
+      HPL_pdgesvO_advise( A, jjn, HPL_numroc( j, nb, nb, mycol, 0,
+                          npcol ) - jjn, 0 );
+      HPL_oost.rbyte += (double)(nns) * (double)(colsz);
+      time = HPL_timer_walltime();
+/*
+ * Apply the panels of the previous slabs, reading the local panels back
+ */
+      for( j = 0; j < c0; j += nb )
+      {
+         jb = nb;
+         HPL_pdreplay( GRID, ALGO, A, j, tag, p );
+         if( mycol == p->pcol )
+         {
+            if( j + npcol * nb < c0 ) HPL_pdgesvO_advise( A, p->jj, jb, 0 );
+            HPL_oost.rbyte += (double)(jb) * (double)(colsz);
+         }
+         jjl   = ( mycol == p->pcol ? p->jj - jb : -1 );
+         p->A  = Mptr( A->A, p->ii, jjs, A->ld );
+         p->jj = jjs; p->nq = nq - jjs; p->ja = c0; p->n = N + 1 - c0;
+         HPL_pdupdate( NULL, NULL, p, nns );
+         if( jjl >= 0 ) HPL_pdgesvO_advise( A, jjl, jb, 1 );
+
+         tag = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
+      }
+      HPL_oost.tleft += HPL_timer_walltime() - time;
+      time = HPL_timer_walltime();
+/*
+ * Factor the slab in-core,  HPL_pdfact recording the L1 factors, pivots
+ * and info scalars in A->R
+ */
+      for( j = c0; j < c1; j += nb )
+      {
+         jb = Mmin( N - j, nb );
+         (void) HPL_pdpanel_free( p );
+         HPL_pdpanel_init( GRID, ALGO, N-j, N-j+1, jb, A, j, j, tag, p );
+
+         HPL_pdfact( p );
+         (void) HPL_binit( p );
+         do
+         { (void) HPL_bcast( p, &test ); }
+         while( test != HPL_SUCCESS );
+         (void) HPL_bwait( p );
+         HPL_pdupdate( NULL, NULL, p, jjn - p->jj );
+
+         tag = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
+      }
+      HPL_oost.tslab += HPL_timer_walltime() - time;
+/*
+ * Write the slab back
+ */
+      HPL_pdgesvO_advise( A, jjs, nns, 1 );
+      HPL_oost.wbyte += (double)(nns) * (double)(colsz);
+      HPL_oost.nslab++;
+   }
+
+   (void) HPL_pdpanel_disp( &p );
+/*
+ * End of HPL_pdgesvO
+ */
+}
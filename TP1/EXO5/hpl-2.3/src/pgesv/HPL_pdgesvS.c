@@ -0,0 +1,306 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+/*
+ * Operands shared by the tasks of the factorization graph
+ */
+typedef struct HPL_S_pdgesvS
+{
+   HPL_T_grid                 * grid;
+   HPL_T_palg                 * algo;
+   HPL_T_pmat                 * pmat;
+   HPL_T_panel                * * panel;
+   int                        l1notran;
+} HPL_T_pdgesvS;
+
+#ifdef STDC_HEADERS
+static void HPL_pdgesvS_appl
+(
+   HPL_T_pdgesvS *                  S,
+   HPL_T_panel *                    P,
+   const int                        JC,
+   const int                        NN
+)
+#else
+static void HPL_pdgesvS_appl( S, P, JC, NN )
+   HPL_T_pdgesvS *                  S;
+   HPL_T_panel *                    P;
+   const int                        JC;
+   const int                        NN;
+#endif
+{
+/*
+ * Apply the row interchanges and the update of the panel P to the NN co-
+ * lumns of A starting at the local column JC.
+ */
+   double                     * Aptr;
+   int                        jb, lda, mp;
+
+   if( NN <= 0 ) return;
+   lda  = S->pmat->ld; jb = P->jb; mp = P->mp - jb;
+   Aptr = Mptr( S->pmat->A, P->ii, JC, lda );
+
+   HPL_dlaswp00N( jb, NN, Aptr, lda, P->IWORK );
+   if( S->l1notran )
+   {
+      HPL_dtrsm( HplColumnMajor, HplLeft, HplLower, HplNoTrans,
+                 HplUnit, jb, NN, HPL_rone, P->L1, jb, Aptr, lda );
+   }
+   else
+   {
+      HPL_dtrsm( HplColumnMajor, HplLeft, HplUpper, HplTrans,
+                 HplUnit, jb, NN, HPL_rone, P->L1, jb, Aptr, lda );
+   }
+   HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, NN, jb,
+              -HPL_rone, P->L2, P->ldl2, Aptr, lda, HPL_rone,
+              Mptr( Aptr, jb, 0, lda ), lda );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvS_fact
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvS_fact( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Factor the panel of columns TASK->i,  and convert its pivots once for
+ * all into local row offsets used by the trailing updates.  When the last
+ * panel shares its column block with the right hand side,  this one is
+ * updated here.
+ */
+   HPL_T_pdgesvS              * S = (HPL_T_pdgesvS *)(TASK->arg);
+   HPL_T_panel                * p;
+   double                     * dpiv;
+   int                        * ipiv;
+   int                        N, i, j, jb, n, nb;
+
+   N = S->pmat->n; nb = S->pmat->nb; j = TASK->i * nb;
+   n = N - j;      jb = Mmin( n, nb );
+
+   HPL_pdpanel_new( S->grid, S->algo, n, n+1, jb, S->pmat, j, j,
+                    MSGID_BEGIN_FACT, &(S->panel[TASK->i]) );
+   p = S->panel[TASK->i];
+   HPL_pdfact( p );
+
+   dpiv = p->DPIV; ipiv = p->IWORK;
+   for( i = 0; i < jb; i++ ) { ipiv[i] = (int)(dpiv[i]) - p->ii; }
+
+   if( ( n == jb ) && ( jb < nb ) )
+      HPL_pdgesvS_appl( S, p, p->jj, p->nq );
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdgesvS_updt
+(
+   HPL_T_task *                     TASK
+)
+#else
+static int HPL_pdgesvS_updt( TASK )
+   HPL_T_task *                     TASK;
+#endif
+{
+/*
+ * Apply the row interchanges and the update of panel TASK->i to the nb
+ * columns of the column block TASK->j.
+ */
+   HPL_T_pdgesvS              * S = (HPL_T_pdgesvS *)(TASK->arg);
+   int                        jc, nb;
+
+   nb = S->pmat->nb; jc = TASK->j * nb;
+   HPL_pdgesvS_appl( S, S->panel[TASK->i], jc,
+                     Mmin( nb, S->pmat->nq - jc ) );
+   return( HPL_SUCCESS );
+}
+
+#ifdef STDC_HEADERS
+void HPL_pdgesvS
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A
+)
+#else
+void HPL_pdgesvS
+( GRID, ALGO, A )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdgesvS factors a N+1-by-N matrix using LU factorization with row
+ * partial pivoting on a 1-by-1 process grid. The factorization is split
+ * into tasks operating on the column blocks of A: the factorization of
+ * panel k,  and the update of column block j by panel k for j > k.  The
+ * tasks are executed by ALGO->nthrd threads as soon as their dependen-
+ * cies are satisfied:  the panel k+1 is factored  as soon as its column
+ * block has been updated by panel k,  while the other threads still up-
+ * date the rest of the trailing submatrix.  The look-ahead is thus dyna-
+ * mic and ALGO->depth is ignored. The panel factorizations are executed
+ * by the calling thread only. The lower triangular factor is left unpi-
+ * voted and the pivots are not returned.  The right hand side is the N+1
+ * column of the coefficient matrix.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information. The grid must be 1-by-1.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input/output)          HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_pdgesvS              S;
+   HPL_T_tpool                pool;
+   HPL_T_task                 * t, * tasks = NULL;
+   HPL_T_task                 * * succ = NULL, * * sp;
+   int                        * off = NULL;
+   int                        N, j, k, kt, nb, ntask, nt;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( N = A->n ) <= 0 ) return;
+/*
+ * kt panels and nt column blocks, the last one holding the rhs.  Tasks
+ * are stored panel by panel: the factorization of panel k,  followed by
+ * the updates of the column blocks k+1 .. nt-1.
+ */
+   nb = A->nb; kt = ( N + nb - 1 ) / nb; nt = ( N + nb ) / nb;
+
+   off = (int *)malloc( (size_t)(kt+1) * sizeof( int ) );
+   S.panel = (HPL_T_panel **)malloc( (size_t)(kt) *
+                                     sizeof( HPL_T_panel * ) );
+   if( ( off == NULL ) || ( S.panel == NULL ) )
+   { HPL_pabort( __LINE__, "HPL_pdgesvS", "Memory allocation failed" ); }
+
+   for( k = 0, off[0] = 0; k < kt; k++ ) off[k+1] = off[k] + nt - k;
+   ntask = off[kt];
+
+   tasks = (HPL_T_task  *)malloc( (size_t)(ntask) * sizeof( HPL_T_task ) );
+   succ  = (HPL_T_task **)malloc( (size_t)(2*ntask) *
+                                  sizeof( HPL_T_task * ) );
+   if( ( tasks == NULL ) || ( succ == NULL ) )
+   { HPL_pabort( __LINE__, "HPL_pdgesvS", "Memory allocation failed" ); }
+
+   S.grid = GRID; S.algo = ALGO; S.pmat = A;
+   S.l1notran = ( ( ALGO->upfun == HPL_pdupdateNN ) ||
+                  ( ALGO->upfun == HPL_pdupdateNT ) );
+/*
+ * Build the graph:  panel k depends on the update of its column block by
+ * panel k-1,  column block j is updated by panel k after panel k is fac-
+ * tored and after it has been updated by panel k-1.
+ */
+   for( k = 0, sp = succ; k < kt; k++ )
+   {
+      for( j = k; j < nt; j++ )
+      {
+         t = tasks + off[k] + j - k;
+         t->arg = (void *)(&S); t->i = k; t->j = j; t->next = NULL;
+         t->succ = sp;
+
+         if( j == k )
+         {
+            t->fun  = HPL_pdgesvS_fact;
+            t->ndep = ( k > 0 ? 1 : 0 ); t->mastr = 1; t->prior = 1;
+            t->seqno = k;
+            for( t->nsucc = 0; t->nsucc < nt - k - 1; t->nsucc++ )
+               *sp++ = tasks + off[k] + t->nsucc + 1;
+         }
+         else
+         {
+            t->fun  = HPL_pdgesvS_updt;
+            t->ndep = ( k > 0 ? 2 : 1 ); t->mastr = 0; t->seqno = -1;
+            t->prior = ( j == k + 1 );
+            t->nsucc = 0;
+            if( k + 1 < kt ) { *sp++ = tasks + off[k+1] + j - k - 1;
+                               t->nsucc = 1; }
+         }
+      }
+   }
+/*
+ * Execute the graph - release panels and work arrays
+ */
+   HPL_tpool_init( &pool, ALGO->nthrd );
+   HPL_tpool_run(  &pool, tasks, ntask );
+   HPL_tpool_exit( &pool );
+
+   for( k = 0; k < kt; k++ ) (void) HPL_pdpanel_disp( &(S.panel[k]) );
+
+   if( succ    ) free( succ    );
+   if( tasks   ) free( tasks   );
+   if( S.panel ) free( S.panel );
+   if( off     ) free( off     );
+/*
+ * End of HPL_pdgesvS
+ */
+}
+
+#endif
@@ -0,0 +1,120 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdgetrs
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A,
+   const int                        NQ,
+   double *                         B
+)
+#else
+void HPL_pdgetrs
+( GRID, ALGO, A, NQ, B )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+   const int                        NQ;
+   double *                         B;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_pdgetrs solves  A X = B  for a batch of right-hand sides with the
+ * LU factorization of A computed by HPL_pdgesv. A must have been facto-
+ * red with a record of its panels (A->R),  so that the pivots and L can
+ * be applied again by HPL_pdtrsmL;  the system with U is then solved by
+ * HPL_pdtrsmU.  Both steps are performed with Level 3 BLAS on the whole
+ * batch,  so that the cost of the factorization  is amortized over the
+ * right-hand sides solved with it.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters used for the factorization.
+ *
+ * A       (local input)                 HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information and the factors computed by HPL_pdgesv.
+ *
+ * NQ      (local input)                 const int
+ *         On entry,  NQ  specifies  the local number of columns of B. NQ
+ *         must be at least zero and the same in a process column.
+ *
+ * B       (local input/output)          double *
+ *         On entry,  B  points to an array of dimension A->ld by NQ con-
+ *         taining the local pieces of the right-hand sides, whose rows
+ *         are distributed as those of A.  On exit,  B is overwritten by
+ *         the solution X.
+ *
+ * ---------------------------------------------------------------------
+ */
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( A->n <= 0 ) || ( A->info != 0 ) || ( A->R == NULL ) ) return;
+
+   HPL_pdtrsmL( GRID, ALGO, A, NQ, B );
+   HPL_pdtrsmU( GRID, A, NQ, B );
+/*
+ * End of HPL_pdgetrs
+ */
+}
@@ -147,9 +147,9 @@ void HPL_pdlaswp01N
  * Compute ipID (if not already done for this panel). lindxA and lindxAU
  * are of length at most 2*jb - iplen is of size nprow+1, ipmap, ipmapm1
  * are of size nprow,  permU is of length jb, and  this function needs a 
- * workspace of size max( 2 * jb (plindx1), nprow+1(equil)): 
- * 1(iflag) + 1(ipl) + 1(ipA) + 9*jb + 3*nprow + 1 + MAX(2*jb,nprow+1)
- * i.e. 4 + 9*jb + 3*nprow + max(2*jb, nprow+1);
+ * workspace of size max( 2 * jb (plindx1), 4*nprow (equil)): 
+ * 1(iflag) + 1(ipl) + 1(ipA) + 9*jb + 3*nprow + 1 + MAX(2*jb,4*nprow)
+ * i.e. 4 + 9*jb + 3*nprow + max(2*jb, 4*nprow);
  */
    k = (int)((unsigned int)(jb) << 1);  ipl = iflag + 1; ipID = ipl + 1;
    ipA     = ipID + ((unsigned int)(k) << 1); lindxA = ipA + 1;
@@ -0,0 +1,127 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#ifdef STDC_HEADERS
+void * HPL_pdooc_alloc
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   const size_t                     LEN
+)
+#else
+void * HPL_pdooc_alloc
+( GRID, ALGO, LEN )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   const size_t                     LEN;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdooc_alloc allocates LEN bytes of memory for the local array  of
+ * the matrix to be factored.  In-core (ALGO->ooc = 0),  this is  plain
+ * malloc.  Out-of-core,  the memory is a shared mapping of a file named
+ * after the prefix ALGO->oocf and the rank of the process,  so that the
+ * pages of the array are written back to that file rather than to swap
+ * space.  The file is unlinked as soon as it is mapped and disappears
+ * with the mapping.  The memory must be released by HPL_pdooc_free.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * LEN     (local input)                 const size_t
+ *         On entry, LEN is the number of bytes to allocate.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   char                       * name;
+   void                       * ptr;
+   int                        fd;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ALGO->ooc <= 0 ) return( malloc( LEN ) );
+
+   name = (char *)malloc( strlen( ALGO->oocf ) + 16 );
+   if( name == NULL ) return( NULL );
+   (void) sprintf( name, "%s.%d", ALGO->oocf, GRID->iam );
+
+   fd = open( name, O_RDWR | O_CREAT | O_TRUNC, 0600 );
+   if( fd >= 0 ) (void) unlink( name );
+   free( name );
+   if( fd < 0 ) return( NULL );
+
+   ptr = MAP_FAILED;
+   if( ftruncate( fd, (off_t)(LEN) ) == 0 )
+      ptr = mmap( NULL, LEN, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+   (void) close( fd );
+
+   return( ptr == MAP_FAILED ? NULL : ptr );
+/*
+ * End of HPL_pdooc_alloc
+ */
+}
@@ -0,0 +1,143 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdreplay
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A,
+   const int                        J,
+   const int                        TAG,
+   HPL_T_panel *                    PANEL
+)
+#else
+void HPL_pdreplay
+( GRID, ALGO, A, J, TAG, PANEL )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+   const int                        J;
+   const int                        TAG;
+   HPL_T_panel *                    PANEL;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_pdreplay  initializes  PANEL again with the panel of the factored
+ * matrix A  starting at the global column  J,  and broadcasts it along
+ * the process rows,  so that it can be applied to other columns by the
+ * update function of ALGO.  The panel is brought in the state HPL_pd-
+ * fact left it in:  L2 is still in A,  L1,  the pivots and the info
+ * scalar are restored from the record A->R made by HPL_pdfact.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input)                 HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information and the factors computed by HPL_pdgesv.
+ *
+ * J       (global input)                const int
+ *         On entry,  J  specifies the global column index of the panel.
+ *         J must be a multiple of A->nb and less than A->n.
+ *
+ * TAG     (global input)                const int
+ *         On entry, TAG is the row broadcast message id.
+ *
+ * PANEL   (local input/output)          HPL_T_panel *
+ *         On entry,  PANEL  points to a panel data structure created by
+ *         HPL_pdpanel_new.  On exit, the panel has been broadcast.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   int                        N, jb, nb, test=HPL_KEEP_TESTING;
+/* ..
+ * .. Executable Statements ..
+ */
+   N = A->n; nb = A->nb; jb = Mmin( N - J, nb );
+
+   (void) HPL_pdpanel_free( PANEL );
+   HPL_pdpanel_init( GRID, ALGO, N-J, N-J+1, jb, A, J, J, TAG, PANEL );
+
+   PANEL->n -= jb; PANEL->ja += jb;
+   if( GRID->mycol == PANEL->pcol )
+   {
+      (void) memcpy( (void *)(PANEL->L1),
+                     (const void *)( A->R + (size_t)(PANEL->jj / nb) *
+                                     (size_t)(nb * nb + nb + 1) ),
+                     (size_t)(jb * jb + jb + 1) * sizeof( double ) );
+      PANEL->A   = Mptr( PANEL->A, 0, jb, PANEL->lda );
+      PANEL->nq -= jb; PANEL->jj += jb;
+   }
+
+   (void) HPL_binit( PANEL );
+   do
+   { (void) HPL_bcast( PANEL, &test ); }
+   while( test != HPL_SUCCESS );
+   (void) HPL_bwait( PANEL );
+/*
+ * End of HPL_pdreplay
+ */
+}
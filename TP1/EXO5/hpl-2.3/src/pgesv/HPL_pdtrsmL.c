@@ -0,0 +1,149 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdtrsmL
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A,
+   const int                        NQ,
+   double *                         B
+)
+#else
+void HPL_pdtrsmL
+( GRID, ALGO, A, NQ, B )
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+   const int                        NQ;
+   double *                         B;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_pdtrsmL  applies  the row interchanges and the unit lower trian-
+ * gular factor  L  of the  matrix  A factored by  HPL_pdgesv  to the NQ
+ * local columns of B, as the factorization did to the right-hand side.
+ * The panels are initialized again from A and the record A->R and broad-
+ * cast by HPL_pdreplay,  and applied to  B  by the update function of
+ * ALGO,  i.e., with Level 3 BLAS  whatever the number of co-
+ * lumns of B. The rows of B are distributed as those of A.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters.
+ *
+ * A       (local input)                 HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information and the factors computed by HPL_pdgesv.
+ *
+ * NQ      (local input)                 const int
+ *         On entry,  NQ  specifies  the local number of columns of B. NQ
+ *         must be at least zero.
+ *
+ * B       (local input/output)          double *
+ *         On entry,  B  points to an array of dimension A->ld by NQ. On
+ *         exit, the rows of B have been interchanged and B has been mul-
+ *         tiplied on the left by the inverse of L.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   HPL_T_panel                * p = NULL;
+   HPL_T_UPD_FUN              HPL_pdupdate;
+   double                     * U = NULL;
+   int                        N, j, nb, tag=MSGID_BEGIN_FACT;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( ( N = A->n ) <= 0 ) || ( A->R == NULL ) ) return;
+
+   HPL_pdupdate = ALGO->upfun; nb = A->nb;
+/*
+ * The update functions  swap and broadcast the rows of U in  PANEL->U,
+ * that is sized after A, provide one sized after B instead.
+ */
+   if( ( GRID->nprow > 1 ) && ( NQ > 0 ) )
+   {
+      U = (double *)malloc( (size_t)(Mmin( N, nb )) * (size_t)(NQ) *
+                            sizeof( double ) );
+      if( U == NULL )
+      { HPL_pabort( __LINE__, "HPL_pdtrsmL", "Memory allocation failed" ); }
+   }
+   HPL_pdpanel_new( GRID, ALGO, N, N+1, Mmin( N, nb ), A, 0, 0, tag, &p );
+
+   for( j = 0; j < N; j += nb )
+   {
+      HPL_pdreplay( GRID, ALGO, A, j, tag, p );
+      p->A  = Mptr( B, p->ii, 0, p->lda ); p->U = U;
+      p->jj = 0; p->nq = NQ; p->ja = N; p->n = NQ;
+      HPL_pdupdate( NULL, NULL, p, NQ );
+
+      tag = MNxtMgid( tag, MSGID_BEGIN_FACT, MSGID_END_FACT );
+   }
+   (void) HPL_pdpanel_disp( &p );
+   if( U ) free( U );
+/*
+ * End of HPL_pdtrsmL
+ */
+}
@@ -0,0 +1,172 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdtrsmU
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_pmat *                     A,
+   const int                        NQ,
+   double *                         B
+)
+#else
+void HPL_pdtrsmU
+( GRID, A, NQ, B )
+   HPL_T_grid *                     GRID;
+   HPL_T_pmat *                     A;
+   const int                        NQ;
+   double *                         B;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_pdtrsmU  solves  U X = B  for the  NQ  local columns of B, where
+ * U is the upper triangular factor of the matrix A factored by HPL_pd-
+ * gesv. The rows of B are distributed as those of A,  and its columns
+ * in any way across the process columns,  that all take part in every
+ * step.
+ *
+ * The diagonal blocks are eliminated from the last one to the first.
+ * For the block column j of U,  the process column owning it broadcasts
+ * its rows above and in the diagonal block along the process rows. The
+ * process row owning the diagonal block then solves for the matching
+ * rows of X  with  dtrsm  and broadcasts them along the process columns,
+ * and every process updates the rows of B above the diagonal block with
+ * dgemm.  Contrary to HPL_pdtrsv, all operations are Level 3 BLAS and
+ * the  N / NB  steps  exchange  messages whose length grows  with  the
+ * number of right-hand sides.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * A       (local input)                 HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information and the factors computed by HPL_pdgesv.
+ *
+ * NQ      (local input)                 const int
+ *         On entry,  NQ  specifies  the local number of columns of B. NQ
+ *         must be at least zero and the same in a process column.
+ *
+ * B       (local input/output)          double *
+ *         On entry,  B  points to an array of dimension A->ld by NQ con-
+ *         taining the local pieces of the right-hand sides.  On exit, B
+ *         is overwritten by the solution X.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   double                     * W = NULL, * X = NULL, * work = NULL;
+   int                        N, icurcol, icurrow, j, jb, lda, mpj, mpr,
+                              mycol, myrow, nb, npcol, nprow;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( N = A->n ) <= 0 ) return;
+
+   (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
+   nb = A->nb; lda = A->ld;
+
+   work = (double *)malloc( ( (size_t)(A->mp) + (size_t)(Mmax( 1, NQ )) ) *
+                            (size_t)(nb) * sizeof( double ) );
+   if( work == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdtrsmU", "Memory allocation failed" ); }
+   W = work; X = work + (size_t)(A->mp) * (size_t)(nb);
+
+   for( j = ( ( N - 1 ) / nb ) * nb; j >= 0; j -= nb )
+   {
+      jb      = Mmin( N - j, nb );
+      icurrow = HPL_indxg2p( j, nb, nb, 0, nprow );
+      icurcol = HPL_indxg2p( j, nb, nb, 0, npcol );
+      mpr     = HPL_numroc( j,      nb, nb, myrow, 0, nprow );
+      mpj     = HPL_numroc( j + jb, nb, nb, myrow, 0, nprow );
+/*
+ * Broadcast the local rows of the block column j of U up to its diago-
+ * nal block along the process rows
+ */
+      if( mpj > 0 )
+      {
+         if( mycol == icurcol )
+            HPL_dlacpy( mpj, jb, Mptr( A->A, 0, HPL_indxg2l( j, nb, nb, 0,
+                        npcol ), lda ), lda, W, mpj );
+         (void) HPL_broadcast( (void *)(W), mpj * jb, HPL_DOUBLE, icurcol,
+                               GRID->row_comm );
+      }
+      if( NQ <= 0 ) continue;
+/*
+ * Solve with the diagonal block  and broadcast these rows of X along the
+ * process columns - update the rows of B above the diagonal block
+ */
+      if( myrow == icurrow )
+      {
+         HPL_dtrsm( HplColumnMajor, HplLeft, HplUpper, HplNoTrans,
+                    HplNonUnit, jb, NQ, HPL_rone, Mptr( W, mpr, 0, mpj ),
+                    mpj, Mptr( B, mpr, 0, lda ), lda );
+         HPL_dlacpy( jb, NQ, Mptr( B, mpr, 0, lda ), lda, X, jb );
+      }
+      (void) HPL_broadcast( (void *)(X), jb * NQ, HPL_DOUBLE, icurrow,
+                            GRID->col_comm );
+      if( mpr > 0 )
+         HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mpr, NQ, jb,
+                    -HPL_rone, W, mpj, X, jb, HPL_rone, B, lda );
+   }
+   if( work ) free( work );
+/*
+ * End of HPL_pdtrsmU
+ */
+}
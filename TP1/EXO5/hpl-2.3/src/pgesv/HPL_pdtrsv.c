@@ -49,6 +49,78 @@
  */
 #include "hpl.h"
 
+#ifdef STDC_HEADERS
+static void HPL_pdtrsv_wght
+(
+   HPL_T_grid *                     GRID,
+   HPL_T_pmat *                     AMAT
+)
+#else
+static void HPL_pdtrsv_wght( GRID, AMAT )
+   HPL_T_grid *                     GRID;
+   HPL_T_pmat *                     AMAT;
+#endif
+{
+/*
+ * Solve with weighted columns,  where consecutive blocks may reside in
+ * the same process column.  Every process accumulates  its part of b-Ux
+ * in XC.  For every diagonal block from the last one, the process row
+ * owning it sums these parts into the process owning the block,  which
+ * solves it.  The solution block is broadcast in that process column,
+ * which then updates its part of the rows above.
+ */
+   double                     * A, * W, * XC, * XR;
+   int                        Anp, Anq, Bcol, i, ia, ja, j, kb, kcol,
+                              krow, lda, mycol, myrow, n, nb, npcol,
+                              nprow;
+
+   n  = AMAT->n;  nb = AMAT->nb; lda = AMAT->ld;
+   A  = AMAT->A;  XR = AMAT->X;
+   (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
+
+   Anp  = HPL_numroc( n, nb, nb, myrow, 0, nprow );
+   Anq  = HPL_numrocW( n, 0, nb, mycol, GRID );
+   Bcol = HPL_indxg2pW( n, nb, GRID );
+   XC   = Mptr( A, 0, Anq, lda );
+   if( mycol != Bcol ) { for( i = 0; i < Anp; i++ ) XC[i] = HPL_rzero; }
+
+   W = (double *)malloc( (size_t)(nb) * sizeof( double ) );
+   if( W == NULL )
+   { HPL_pabort( __LINE__, "HPL_pdtrsv", "Memory allocation failed" ); }
+
+   for( j = ( ( n - 1 ) / nb ) * nb; j >= 0; j -= nb )
+   {
+      kb   = Mmin( nb, n - j );
+      krow = HPL_indxg2p( j, nb, nb, 0, nprow );
+      kcol = HPL_indxg2pW( j, nb, GRID );
+      ia   = HPL_numroc( j, nb, nb, myrow, 0, nprow );
+      ja   = HPL_numrocW( j, 0, nb, mycol, GRID );
+
+      if( myrow == krow )
+      {
+         HPL_dcopy( kb, XC+ia, 1, W, 1 );
+         (void) HPL_reduce( (void *)(W), kb, HPL_DOUBLE, HPL_sum, kcol,
+                            GRID->row_comm );
+         if( mycol == kcol )
+         {
+            HPL_dtrsv( HplColumnMajor, HplUpper, HplNoTrans, HplNonUnit,
+                       kb, Mptr( A, ia, ja, lda ), lda, W, 1 );
+            HPL_dcopy( kb, W, 1, XR+ja, 1 );
+         }
+      }
+      if( mycol == kcol )
+      {
+         (void) HPL_broadcast( (void *)(XR+ja), kb, HPL_DOUBLE, krow,
+                               GRID->col_comm );
+         if( ia > 0 )
+            HPL_dgemv( HplColumnMajor, HplNoTrans, ia, kb, -HPL_rone,
+                       Mptr( A, 0, ja, lda ), lda, XR+ja, 1, HPL_rone,
+                       XC, 1 );
+      }
+   }
+   free( W );
+}
+
 #ifdef STDC_HEADERS
 void HPL_pdtrsv
 (
@@ -90,6 +162,11 @@ void HPL_pdtrsv
  * length NB to compute the next  NB  entries of the vector solution, as
  * well as performing a total of N^2 floating point operations.
  *
+ * When the columns of the grid are weighted  (GRID->ncyc > 0),  the
+ * blocks are instead solved one after the other without look-ahead: the
+ * pieces of the rhs are summed in the process row of every block,  and
+ * the solution block is broadcast in its process column.
+ *
  * Arguments
  * =========
  *
@@ -124,6 +201,15 @@ void HPL_pdtrsv
    if( ( n = AMAT->n ) <= 0 ) return;
    nb = AMAT->nb; lda = AMAT->ld; A = AMAT->A; XR = AMAT->X;
 
+   if( GRID->ncyc > 0 )
+   {
+      HPL_pdtrsv_wght( GRID, AMAT );
+#ifdef HPL_DETAILED_TIMING
+      HPL_ptimer( HPL_TIMING_PTRSV );
+#endif
+      return;
+   }
+
    (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
    Rcomm = GRID->row_comm; Rmsgid = MSGID_BEGIN_PTRSV;
    Ccomm = GRID->col_comm; Cmsgid = MSGID_BEGIN_PTRSV + 1;
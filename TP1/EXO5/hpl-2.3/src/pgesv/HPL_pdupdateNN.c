@@ -100,7 +100,8 @@ void HPL_pdupdateNN
 /*
  * .. Local Variables ..
  */
-   double                    * Aptr, * L1ptr, * L2ptr, * Uptr, * dpiv;
+   double                    * Aptr, * L1ptr, * L2ptr, * L2pk, * Uptr,
+                             * dpiv;
    int                       * ipiv;
 #ifdef HPL_CALL_VSIPL
    vsip_mview_d              * Av0, * Av1, * Lv0, * Lv1, * Uv0, * Uv1;
@@ -133,6 +134,10 @@ void HPL_pdupdateNN
 #endif
       return;
    }
+/*
+ * Pack L2 once for all the column blocks updated below
+ */
+   HPL_pdpanel_pack( PANEL ); L2pk = PANEL->L2P;
 /*
  * Enable/disable the column panel probing mechanism
  */
@@ -197,9 +202,9 @@ void HPL_pdupdateNN
          (void) vsip_mdestroy_d( Av1 );
          (void) vsip_mdestroy_d( Uv1 );
 #else
-         HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, nn,
-                    jb, -HPL_rone, L2ptr, ldl2, Aptr, lda, HPL_rone,
-                    Mptr( Aptr, jb, 0, lda ), lda );
+         HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, L2pk, L2ptr,
+                      ldl2, Aptr, lda, HPL_rone,
+                      Mptr( Aptr, jb, 0, lda ), lda );
 #endif
          Aptr = Mptr( Aptr, 0, nn, lda ); nq0 += nn; 
 
@@ -234,9 +239,9 @@ void HPL_pdupdateNN
          (void) vsip_mdestroy_d( Av1 );
          (void) vsip_mdestroy_d( Uv1 );
 #else
-         HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, nn,
-                    jb, -HPL_rone, L2ptr, ldl2, Aptr, lda, HPL_rone,
-                    Mptr( Aptr, jb, 0, lda ), lda );
+         HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, L2pk, L2ptr,
+                      ldl2, Aptr, lda, HPL_rone,
+                      Mptr( Aptr, jb, 0, lda ), lda );
 #endif
       }
 #ifdef HPL_CALL_VSIPL
@@ -320,9 +325,9 @@ void HPL_pdupdateNN
             (void) vsip_mdestroy_d( Av1 );
             (void) vsip_mdestroy_d( Uv1 );
 #else
-            HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, nn,
-                       jb, -HPL_rone, L2ptr, ldl2, Uptr, LDU, HPL_rone,
-                       Mptr( Aptr, jb, 0, lda ), lda );
+            HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, L2pk, L2ptr,
+                         ldl2, Uptr, LDU, HPL_rone,
+                         Mptr( Aptr, jb, 0, lda ), lda );
 #endif
             HPL_dlacpy( jb, nn, Uptr, LDU, Aptr, lda );
          }
@@ -343,9 +348,9 @@ void HPL_pdupdateNN
             (void) vsip_mdestroy_d( Av1 );
             (void) vsip_mdestroy_d( Uv1 );
 #else
-            HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, nn,
-                       jb, -HPL_rone, L2ptr, ldl2, Uptr, LDU, HPL_rone,
-                       Aptr, lda );
+            HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, L2pk, L2ptr,
+                         ldl2, Uptr, LDU, HPL_rone,
+                         Aptr, lda );
 #endif
          }
          Uptr = Mptr( Uptr, 0, nn, LDU );
@@ -378,9 +383,9 @@ void HPL_pdupdateNN
             (void) vsip_mdestroy_d( Av1 );
             (void) vsip_mdestroy_d( Uv1 );
 #else
-            HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, nn,
-                       jb, -HPL_rone, L2ptr, ldl2, Uptr, LDU, HPL_rone,
-                       Mptr( Aptr, jb, 0, lda ), lda );
+            HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, L2pk, L2ptr,
+                         ldl2, Uptr, LDU, HPL_rone,
+                         Mptr( Aptr, jb, 0, lda ), lda );
 #endif
             HPL_dlacpy( jb, nn, Uptr, LDU, Aptr, lda );
          }
@@ -401,9 +406,9 @@ void HPL_pdupdateNN
             (void) vsip_mdestroy_d( Av1 );
             (void) vsip_mdestroy_d( Uv1 );
 #else
-            HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, nn,
-                       jb, -HPL_rone, L2ptr, ldl2, Uptr, LDU, HPL_rone,
-                       Aptr, lda );
+            HPL_dgemmpk( HplNoTrans, mp, nn, jb, -HPL_rone, L2pk, L2ptr,
+                         ldl2, Uptr, LDU, HPL_rone,
+                         Aptr, lda );
 #endif
          }
       }
@@ -49,6 +49,32 @@
  */
 #include "hpl.h"
 
+#ifdef STDC_HEADERS
+static int HPL_pipid_slot
+(
+   const int *                      HKEY,
+   const int                        HMSK,
+   const int                        ROW
+)
+#else
+static int HPL_pipid_slot( HKEY, HMSK, ROW )
+   const int *                      HKEY;
+   const int                        HMSK;
+   const int                        ROW;
+#endif
+{
+/*
+ * Return the slot of the open addressing hash table HKEY holding  ROW,
+ * or the first empty slot (-1) met while probing for it.
+ */
+   unsigned int               h;
+
+   h = ( (unsigned int)(ROW) * 2654435761U ) & (unsigned int)(HMSK);
+   while( ( HKEY[h] != -1 ) && ( HKEY[h] != ROW ) )
+      h = ( h + 1 ) & (unsigned int)(HMSK);
+   return( (int)(h) );
+}
+
 #ifdef STDC_HEADERS
 void HPL_pipid
 (
@@ -108,6 +134,13 @@ void HPL_pipid
  * first N entries are such that IPID(k) with k odd is equal to  IA+k/2.
  * For k in  [0..K/2),  the  row  of global index  IPID(2*k)  should  be
  * mapped onto the row of global index IPID(2*k+1).
+ *  
+ * The destinations are located with a hash table mapping a row onto its
+ * position in IPID, so that IPID is built in O(N) operations.  Once  it
+ * is complete, the table  PANEL->IPTAB  is filled for HPL_plindx0,  HPL_
+ * plindx1 and  HPL_plindx10:  for the pair k,  it holds the process row
+ * and local index of  IPID(2*k)  and IPID(2*k+1),  and the destination
+ * IPID(2*k1+1) of the pair k1 such that IPID(2*k1) is IPID(2*k+1).
  *
  * Arguments
  * =========
@@ -133,43 +166,69 @@ void HPL_pipid
 /*
  * .. Local Variables ..
  */
-   int                        dst, fndd, fnds, ia, i, j, jb, lst, off,
-                              src;
+   int                        * dloc, * dnext, * drow, * hkey, * hval,
+                              * ipiv, * sloc, * srow;
    double                     * dpiv;
+   int                        dst, fndd, fnds, h, hmsk, ia, i, j, jb,
+                              k, lst, nb, np, nprow, off, src;
 /* ..
  * .. Executable Statements ..
  */
-   dpiv = PANEL->DPIV; jb = PANEL->jb; src = ia = PANEL->ia;
-   dst  = (int)(dpiv[0]); IPID[0] = dst; IPID[1] = src; *K = 2;
-   if( src != dst ) { IPID[2] = src; IPID[3] = dst; *K += 2; }
+   dpiv  = PANEL->DPIV; jb = PANEL->jb; nb = PANEL->nb; ia = PANEL->ia;
+   nprow = PANEL->grid->nprow;
+
+   for( h = 1; h < ( jb << 2 ); h <<= 1 );
+   hmsk = h - 1; k = jb << 1;
+   srow = PANEL->IPTAB; sloc = srow + k;  drow  = sloc + k;
+   dloc = drow + k;     dnext = dloc + k; ipiv  = dnext + k;
+   hkey = ipiv + jb;    hval = hkey + h;
+
+   for( i = 0; i < jb; i++ ) ipiv[i] = (int)(dpiv[i]);
+   for( i = 0; i < h;  i++ ) hkey[i] = -1;
+/*
+ * hval[slot of row] is the position in IPID of row as a destination.  A
+ * row that is no longer a destination keeps a stale slot, hence lookups
+ * check IPID; fndd and fnds are 0 when the row is not found.
+ */
+   src = ia; dst = ipiv[0]; IPID[0] = dst; IPID[1] = src; *K = 2;
+   j = HPL_pipid_slot( hkey, hmsk, src ); hkey[j] = src; hval[j] = 1;
+   if( src != dst )
+   {
+      IPID[2] = src; IPID[3] = dst; *K += 2;
+      j = HPL_pipid_slot( hkey, hmsk, dst ); hkey[j] = dst; hval[j] = 3;
+   }
 
    for( i = 1; i < jb; i++ )
    {
-      fnds = 0; j = 1;
+      src = ia + i; dst = ipiv[i];
+
+      j = HPL_pipid_slot( hkey, hmsk, src );
+      fnds = ( ( hkey[j] == src ) && ( IPID[hval[j]] == src ) ? hval[j] : 0 );
 
-      if( ( src = ia + i ) == ( dst = (int)(dpiv[i]) ) )
+      if( src == dst )
       {
-         do { if( src == IPID[j] ) { fnds = j; } else { j += 2; } }
-         while( !( fnds ) && ( j < *K ) );
-         if( !fnds ) { lst = *K;     off = 2; IPID[lst] = src; }
-         else        { lst = fnds-1; off = 0; }
-         IPID[lst+1] = dst;
+         if( !fnds )
+         {
+            lst = *K; off = 2; IPID[lst] = src; IPID[lst+1] = dst;
+            hkey[j] = dst; hval[j] = lst+1;
+         }
+         else { lst = fnds-1; off = 0; }
       }
       else
       {
-         fndd = 0;
-         do
-         {
-            if     ( src == IPID[j] ) { fnds = j; }
-            else if( dst == IPID[j] ) { fndd = j; }
-            j += 2;
-         }
-         while( ( !( fnds ) || !( fndd ) ) && ( j < *K ) );
+         j = HPL_pipid_slot( hkey, hmsk, dst );
+         fndd = ( ( hkey[j] == dst ) && ( IPID[hval[j]] == dst ) ?
+                  hval[j] : 0 );
+
          if( !fnds ) { IPID[*K] = src; IPID[*K+1] = dst; off  = 2; }
          else        {                 IPID[fnds] = dst; off  = 0; }
+         hkey[j] = dst; hval[j] = ( fnds ? fnds : *K+1 );
+
          if( !fndd ) { lst = *K+off;   IPID[lst ] = dst; off += 2; }
          else        { lst = fndd-1; }
          IPID[lst+1] = src;
+         j = HPL_pipid_slot( hkey, hmsk, src ); hkey[j] = src;
+         hval[j] = lst+1;
       }
 /*
  * Enforce IPID(1,i) equal to src = ia + i
@@ -178,9 +237,36 @@ void HPL_pipid
       {
          src = IPID[j  ]; IPID[j  ] = IPID[lst  ]; IPID[lst  ] = src;
          dst = IPID[j+1]; IPID[j+1] = IPID[lst+1]; IPID[lst+1] = dst;
+         np = HPL_pipid_slot( hkey, hmsk, IPID[j+1] );
+         hkey[np] = IPID[j+1];   hval[np] = j+1;
+         np = HPL_pipid_slot( hkey, hmsk, IPID[lst+1] );
+         hkey[np] = IPID[lst+1]; hval[np] = lst+1;
       }
       *K += off;
    }
+/*
+ * Tabulate the owners and local indexes of the rows of every pair,  and
+ * map the sources onto their pair to find where a row swapped away from
+ * the current process row ends up in U.
+ */
+   np = *K >> 1;
+   for( k = 0; k < np; k++ )
+   {
+      Mindxg2lp( sloc[k], srow[k], IPID[2*k  ], nb, nb, 0, nprow );
+      Mindxg2lp( dloc[k], drow[k], IPID[2*k+1], nb, nb, 0, nprow );
+   }
+
+   for( i = 0; i < h; i++ ) hkey[i] = -1;
+   for( k = 0; k < np; k++ )
+   {
+      j = HPL_pipid_slot( hkey, hmsk, IPID[2*k] );
+      hkey[j] = IPID[2*k]; hval[j] = k;
+   }
+   for( k = 0; k < np; k++ )
+   {
+      dst = IPID[2*k+1]; j = HPL_pipid_slot( hkey, hmsk, dst );
+      dnext[k] = ( hkey[j] == dst ? IPID[2*hval[j]+1] : IPID[*K-1] );
+   }
 /*
  * End of HPL_pipid
  */
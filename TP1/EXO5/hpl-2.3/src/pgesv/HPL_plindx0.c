@@ -106,7 +106,8 @@ void HPL_plindx0
  * this row is  copied into  U, exactly where the row IPID(2*i+1) should
  * go. For this, we search IPID for k1, such that IPID(2*k1) is equal to
  * IPID(2*i+1); and row  IPID(2*i) is to be copied in U  at the position
- * IPID(2*k1+1)-IA.
+ * IPID(2*k1+1)-IA.  HPL_pipid  has  tabulated  IPID(2*k1+1),  and  the
+ * owners and local indexes of the rows of IPID, in PANEL->IPTAB.
  *  
  * It is thus  important to put the rows that go into U, i.e., such that
  * IPID(2*i+1) - IA is less than N at the begining of the array IPID. By
@@ -222,9 +223,9 @@ void HPL_plindx0
 /*
  * .. Local Variables ..
  */
-   int                        dst, dstrow, fndd, i, ia, icurrow, il,
-                              ip=0, iroff, j, jb, myrow, nb, nprow,
-                              src, srcrow;
+   int                        * dloc, * dnext, * drow, * sloc, * srow;
+   int                        dst, i, ia, icurrow, ip=0, iroff, jb, k,
+                              myrow, nprow, srcrow;
 /* ..
  * .. Executable Statements ..
  */
@@ -235,39 +236,31 @@ void HPL_plindx0
  */
    myrow   = PANEL->grid->myrow; nprow = PANEL->grid->nprow;
    icurrow = PANEL->prow;        jb    = PANEL->jb;
-   nb      = PANEL->nb;          ia    = PANEL->ia;
-   iroff   = PANEL->ii;
+   ia      = PANEL->ia;          iroff = PANEL->ii;
+
+   srow = PANEL->IPTAB; sloc  = srow + (jb << 1); drow = sloc + (jb << 1);
+   dloc = drow + (jb << 1); dnext = dloc + (jb << 1);
 
    for( i = 0; i < nprow; i++ ) LLEN[i] = 0;
 
-   for( i = 0; i < K; i += 2 )
+   for( i = 0, k = 0; i < K; i += 2, k++ )
    {
-      src = IPID[i];
-      Mindxg2p( src, nb, nb, srcrow, 0, nprow ); LLEN[ srcrow ]++;
+      srcrow = srow[k]; LLEN[ srcrow ]++;
 
       if( myrow == srcrow )
       {
-         Mindxg2l( il, src, nb, nb, myrow, 0, nprow );
-         LINDXA[ip] = il - iroff; dst = IPID[i+1];
+         LINDXA[ip] = sloc[k] - iroff; dst = IPID[i+1];
 
          if( myrow == icurrow )
          {
-            Mindxg2p( dst, nb, nb, dstrow, 0, nprow );
-            if( dstrow == icurrow )
+            if( drow[k] == icurrow )
             {
                if( dst - ia < jb ) { LINDXAU[ip] = dst - ia; }
-               else
-               {
-                  Mindxg2l( il, dst, nb, nb, myrow, 0, nprow );
-                  LINDXAU[ip] = iroff - il;
-               }
+               else                { LINDXAU[ip] = iroff - dloc[k]; }
             }
             else
             {
-               j = 0;
-               do { fndd = ( dst == IPID[j] ); j+=2; }
-               while( !fndd && ( j < K ) );
-               LINDXAU[ip] = IPID[j-1] - ia;
+               LINDXAU[ip] = dnext[k] - ia;
             }
          }
          else { LINDXAU[ip] = dst - ia; }
@@ -88,7 +88,9 @@ void HPL_plindx1
  * the  local  source and final destination position  resulting from the
  * application of row interchanges.  In addition, this function computes
  * three arrays IPLEN, IPMAP and IPMAPM1  that contain  the  logarithmic
- * mapping information for the spreading phase.
+ * mapping information for the spreading phase. The owners and local
+ * indexes of the rows of  IPID  are read from the table  PANEL->IPTAB
+ * built by HPL_pipid.
  *
  * Arguments
  * =========
@@ -160,10 +162,10 @@ void HPL_plindx1
 /*
  * .. Local Variables ..
  */
-   int                        * iwork;
-   int                        dst, dstrow, fndd, i, ia, icurrow, il,
-                              ip, ipU, iroff, j, jb, myrow, nb, nprow,
-                              src, srcrow;
+   int                        * dloc, * dnext, * drow, * iwork,
+                              * sloc, * srow;
+   int                        dst, dstrow, i, ia, icurrow, il, ip, ipU,
+                              iroff, j, jb, k, myrow, nprow, srcrow;
 /* ..
  * .. Executable Statements ..
  */
@@ -178,23 +180,23 @@ void HPL_plindx1
  * elsewhere and PERMU in every process.
  */
    myrow = PANEL->grid->myrow; nprow   = PANEL->grid->nprow;
-   jb    = PANEL->jb;          nb      = PANEL->nb;     ia = PANEL->ia;
+   jb    = PANEL->jb;          ia      = PANEL->ia;
    iroff = PANEL->ii;          icurrow = PANEL->prow;
 
+   srow  = PANEL->IPTAB; sloc  = srow + (jb << 1); drow = sloc + (jb << 1);
+   dloc  = drow + (jb << 1); dnext = dloc + (jb << 1);
+
    iwork = IWORK + jb;
  
    if( myrow == icurrow )
    {
-      for( i = 0, ip = 0, ipU = 0; i < K; i += 2 )
+      for( i = 0, k = 0, ip = 0, ipU = 0; i < K; i += 2, k++ )
       {
-         src = IPID[i]; Mindxg2p( src, nb, nb, srcrow, 0, nprow );
- 
-         if( srcrow == icurrow )
+         if( srow[k] == icurrow )
          {
-            dst = IPID[i+1]; Mindxg2p( dst, nb, nb, dstrow, 0, nprow );
+            dst = IPID[i+1]; dstrow = drow[k];
  
-            Mindxg2l( il, src, nb, nb, myrow, 0, nprow );
-            LINDXA[ip] = il - iroff;
+            LINDXA[ip] = sloc[k] - iroff;
  
             if( ( dstrow == icurrow ) && ( dst - ia < jb ) )
             {
@@ -204,18 +206,13 @@ void HPL_plindx1
             }
             else if( dstrow != icurrow )
             {
-               j = 0;
-               do { fndd = ( dst == IPID[j] ); j+=2; }
-               while( !fndd && ( j < K ) );
- 
-               PERMU[ipU] = IPID[j-1]-ia; il = IPMAPM1[dstrow];
+               PERMU[ipU] = dnext[k]-ia; il = IPMAPM1[dstrow];
                j          = IPLEN[il];    iwork[ipU] = LINDXAU[ip] = j;
                IPLEN[il]++; ipU++;
             }
             else if( ( dstrow == icurrow ) && ( dst - ia >= jb ) )
             {
-               Mindxg2l( il, dst, nb, nb, myrow, 0, nprow );
-               LINDXAU[ip] = iroff - il;
+               LINDXAU[ip] = iroff - dloc[k];
             }
             ip++;
          }
@@ -224,17 +221,15 @@ void HPL_plindx1
    }
    else
    {
-      for( i = 0, ip = 0, ipU = 0; i < K; i += 2 )
+      for( i = 0, k = 0, ip = 0, ipU = 0; i < K; i += 2, k++ )
       {
-         src = IPID[i  ]; Mindxg2p( src, nb, nb, srcrow, 0, nprow );
-         dst = IPID[i+1]; Mindxg2p( dst, nb, nb, dstrow, 0, nprow );
+         srcrow = srow[k]; dst = IPID[i+1]; dstrow = drow[k];
 /*
  * LINDXA[i] is the local index of the row of A that belongs into U
  */
          if( myrow == dstrow )
          {
-            Mindxg2l( il, dst, nb, nb, myrow, 0, nprow );
-            LINDXA[ip] = il - iroff; ip++;
+            LINDXA[ip] = dloc[k] - iroff; ip++;
          }
 /*
  * iwork[i] is the local (current) position  index in U
@@ -249,10 +244,7 @@ void HPL_plindx1
             }
             else if( dstrow != icurrow )
             {
-               j = 0;
-               do { fndd = ( dst == IPID[j] ); j+=2; }
-               while( !fndd && ( j < K ) );
-               PERMU[ipU] = IPID[j-1] - ia; il = IPMAPM1[dstrow];
+               PERMU[ipU] = dnext[k] - ia; il = IPMAPM1[dstrow];
                iwork[ipU] = IPLEN[il]; IPLEN[il]++; ipU++;
             }
          }
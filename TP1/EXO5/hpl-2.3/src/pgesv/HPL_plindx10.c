@@ -76,6 +76,8 @@ void HPL_plindx10
  *
  * HPL_plindx10 computes  three arrays  IPLEN,  IPMAP  and  IPMAPM1  that
  * contain the logarithmic mapping information for the spreading phase.
+ * The process rows owning the rows of IPID are read from the table
+ * PANEL->IPTAB built by HPL_pipid.
  *
  * Arguments
  * =========
@@ -122,25 +124,27 @@ void HPL_plindx10
 /*
  * .. Local Variables ..
  */
-   int                        dst, dstrow, i, ia, icurrow, jb, nb,
-                              nprow, src, srcrow;
+   int                        * drow, * srow;
+   int                        dst, dstrow, i, ia, icurrow, jb, k,
+                              nprow, srcrow;
 /* ..
  * .. Executable Statements ..
  */
-   nprow = PANEL->grid->nprow; jb = PANEL->jb; nb = PANEL->nb;
-   ia    = PANEL->ia;          icurrow = PANEL->prow;
+   nprow = PANEL->grid->nprow; jb = PANEL->jb; ia = PANEL->ia;
+   icurrow = PANEL->prow;
+   srow  = PANEL->IPTAB;       drow = srow + 4 * jb;
 /*
  * Compute  redundantly  the local number of rows  that each process has
  * and that belong to U in IPLEN[1 .. nprow+1]
  */
    for( i = 0; i <= nprow; i++ ) IPLEN[i] = 0;
  
-   for( i = 0; i < K; i += 2 )
+   for( i = 0, k = 0; i < K; i += 2, k++ )
    {
-      src = IPID[i]; Mindxg2p( src, nb, nb, srcrow, 0, nprow );
+      srcrow = srow[k];
       if( srcrow == icurrow )
       {
-         dst = IPID[i+1]; Mindxg2p( dst, nb, nb, dstrow, 0, nprow );
+         dst = IPID[i+1]; dstrow = drow[k];
          if( ( dstrow != srcrow ) || ( dst - ia < jb ) ) IPLEN[dstrow+1]++;
       }
    }
@@ -50,7 +50,7 @@
 #include "hpl.h"
 
 #ifdef STDC_HEADERS
-void HPL_pdmatgen
+void HPL_pdmatgenp
 (
    const HPL_T_grid *               GRID,
    const int                        M,
@@ -58,11 +58,13 @@ void HPL_pdmatgen
    const int                        NB,
    double *                         A,
    const int                        LDA,
-   const int                        ISEED
+   const int                        ISEED,
+   const HPL_T_PROG_FUN             POST,
+   void *                           ARG
 )
 #else
-void HPL_pdmatgen
-( GRID, M, N, NB, A, LDA, ISEED )
+void HPL_pdmatgenp
+( GRID, M, N, NB, A, LDA, ISEED, POST, ARG )
    const HPL_T_grid *               GRID;
    const int                        M;
    const int                        N;
@@ -70,13 +72,17 @@ void HPL_pdmatgen
    double *                         A;
    const int                        LDA;
    const int                        ISEED;
+   const HPL_T_PROG_FUN             POST;
+   void *                           ARG;
 #endif
 {
 /* 
  * Purpose
  * =======
  *
- * HPL_pdmatgen generates (or regenerates) a parallel random matrix A.
+ * HPL_pdmatgenp generates (or regenerates) a parallel random matrix A,
+ * and reports its progress after every local block of columns. The co-
+ * lumns follow the distribution of GRID, weighted or not.
  *  
  * The  pseudo-random  generator uses the linear congruential algorithm:
  * X(n+1) = (a * X(n) + c) mod m  as  described  in the  Art of Computer
@@ -114,6 +120,15 @@ void HPL_pdmatgen
  *         On entry, ISEED  specifies  the  seed  number to generate the
  *         matrix A. ISEED must be at least zero.
  *
+ * POST    (local input)                 const HPL_T_PROG_FUN
+ *         On entry, POST is NULL, or the function called with ARG and
+ *         the number of leading local columns of A generated so far,
+ *         after every local block of columns and once on exit. The
+ *         columns it reports may then be read by another thread.
+ *
+ * ARG     (local input/output)          void *
+ *         On entry, ARG is the first argument passed to POST.
+ *
  * ---------------------------------------------------------------------
  */ 
 /*
@@ -141,9 +156,10 @@ void HPL_pdmatgen
  * Generate an M by N matrix starting in process (0,0)
  */
    Mnumroc( mp, M, NB, NB, myrow, 0, nprow );
-   Mnumroc( nq, N, NB, NB, mycol, 0, npcol );
+   nq = HPL_numrocW( N, 0, NB, mycol, GRID );
 
-   if( ( mp <= 0 ) || ( nq <= 0 ) ) return;
+   if( ( mp <= 0 ) || ( nq <= 0 ) )
+   { if( POST ) POST( ARG, nq ); return; }
 /*
  * Local number of blocks and size of the last one
  */
@@ -153,7 +169,8 @@ void HPL_pdmatgen
  * Compute multiplier/adder for various jumps in random sequence
  */
    jump1 = 1;  jump2 = nprow * NB; jump3 = M; jump4 = npcol * NB;
-   jump5 = NB; jump6 = mycol;      jump7 = myrow * NB;
+   jump5 = NB; jump6 = HPL_indxl2gW( 0, NB, mycol, GRID ) / NB;
+   jump7 = myrow * NB;
 
    HPL_xjumpm( jump1, mult, iadd, jseed, iran1, ia1,   ic1   );
    HPL_xjumpm( jump2, mult, iadd, iran1, itmp1, ia2,   ic2   );
@@ -187,11 +204,98 @@ void HPL_pdmatgen
          ib1[0] = iran3[0]; ib1[1] = iran3[1];
          ib2[0] = iran3[0]; ib2[1] = iran3[1];
       }
-      HPL_jumpit( ia4, ic4, ib3, iran4 );
+      if( GRID->ncyc == 0 )
+      {
+         HPL_jumpit( ia4, ic4, ib3, iran4 );
+      }
+      else
+      {
+/*
+ * With weighted columns, jump to the global block of my next local one
+ */
+         jump4 = ( jblk < nblks - 1 ?
+                   HPL_indxl2gW( ( jblk + 1 ) * NB, NB, mycol, GRID ) / NB -
+                   HPL_indxl2gW( jblk * NB, NB, mycol, GRID ) / NB : 0 );
+         HPL_xjumpm( jump4, ia5, ic5, ib3, iran4, itmp1, itmp2 );
+      }
       ib1[0] = iran4[0]; ib1[1] = iran4[1];
       ib2[0] = iran4[0]; ib2[1] = iran4[1];
       ib3[0] = iran4[0]; ib3[1] = iran4[1];
+      if( POST ) POST( ARG, Mmin( nq, ( jblk + 1 ) * NB ) );
    }
+/*
+ * End of HPL_pdmatgenp
+ */
+}
+
+#ifdef STDC_HEADERS
+void HPL_pdmatgen
+(
+   const HPL_T_grid *               GRID,
+   const int                        M,
+   const int                        N,
+   const int                        NB,
+   double *                         A,
+   const int                        LDA,
+   const int                        ISEED
+)
+#else
+void HPL_pdmatgen
+( GRID, M, N, NB, A, LDA, ISEED )
+   const HPL_T_grid *               GRID;
+   const int                        M;
+   const int                        N;
+   const int                        NB;
+   double *                         A;
+   const int                        LDA;
+   const int                        ISEED;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdmatgen generates (or regenerates) a parallel random matrix A.
+ * See HPL_pdmatgenp for the generator.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 const HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * M       (global input)                const int
+ *         On entry,  M  specifies  the number  of rows of the matrix A.
+ *         M must be at least zero.
+ *
+ * N       (global input)                const int
+ *         On entry,  N specifies the number of columns of the matrix A.
+ *         N must be at least zero.
+ *
+ * NB      (global input)                const int
+ *         On entry,  NB specifies the blocking factor used to partition
+ *         and distribute the matrix A. NB must be larger than one.
+ *
+ * A       (local output)                double *
+ *         On entry,  A  points  to an array of dimension (LDA,LocQ(N)).
+ *         On exit, this array contains the coefficients of the randomly
+ *         generated matrix.
+ *
+ * LDA     (local input)                 const int
+ *         On entry, LDA specifies the leading dimension of the array A.
+ *         LDA must be at least max(1,LocP(M)).
+ *
+ * ISEED   (global input)                const int
+ *         On entry, ISEED  specifies  the  seed  number to generate the
+ *         matrix A. ISEED must be at least zero.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/* ..
+ * .. Executable Statements ..
+ */
+   HPL_pdmatgenp( GRID, M, N, NB, A, LDA, ISEED, NULL, NULL );
 /*
  * End of HPL_pdmatgen
  */
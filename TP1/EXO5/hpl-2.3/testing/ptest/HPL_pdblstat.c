@@ -0,0 +1,192 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_BLAS_STATS
+
+#ifdef STDC_HEADERS
+void HPL_pdblstat
+(
+   HPL_T_test *                     TEST,
+   HPL_T_grid *                     GRID
+)
+#else
+void HPL_pdblstat
+( TEST, GRID )
+   HPL_T_test *                     TEST;
+   HPL_T_grid *                     GRID;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdblstat  combines the BLAS call statistics  collected  by  the
+ * processes of GRID since the last call to HPL_blas_reset  and prints
+ * them on process 0.  For every process  and every routine called,  it
+ * prints the number of calls, the aggregated wall time, the number of
+ * floating point operations and the achieved rate.  It then prints the
+ * shape histogram of every routine summed over all processes,  i.e.,
+ * the same quantities for the calls whose  smallest operand dimension
+ * falls in [ 2^b, 2^(b+1) ).
+ *
+ * Arguments
+ * =========
+ *
+ * TEST    (global input/output)         HPL_T_test *
+ *         On entry,  TEST  points  to the test data structure: outfp is
+ *         the output file stream.
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   static const char          * name[HPL_BLAS_NFUN] =
+   { "dcopy", "daxpy", "dscal", "idamax", "dgemv", "dtrsv", "dger",
+     "dgemm", "dtrsm" };
+   double                     hist[3*HPL_BLAS_NFUN*HPL_BLAS_NBIN];
+   double                     * stats = NULL, * st;
+   int                        b, i, iam, k, lstat, nprocs, p;
+/* ..
+ * .. Executable Statements ..
+ */
+   iam = GRID->iam; nprocs = GRID->nprocs; lstat = 3 * HPL_BLAS_NFUN;
+/*
+ * Per process totals: every process fills its own slot, the sum gathers
+ * them on process 0.
+ */
+   stats = (double *)malloc( (size_t)(nprocs) * (size_t)(lstat) *
+                             sizeof( double ) );
+   i = ( stats == NULL );
+   (void) HPL_all_reduce( (void *)(&i), 1, HPL_INT, HPL_max,
+                          GRID->all_comm );
+   if( i != 0 )
+   {
+      if( iam == 0 )
+         HPL_pwarn( TEST->outfp, __LINE__, "HPL_pdblstat", "%s",
+                    "Memory allocation failed for BLAS statistics. Skip." );
+      if( stats ) free( stats );
+      return;
+   }
+   for( i = 0; i < nprocs * lstat; i++ ) stats[i] = HPL_rzero;
+
+   st = stats + iam * lstat;
+   for( k = 0; k < HPL_BLAS_NFUN; k++ )
+   {
+      for( b = 0; b < HPL_BLAS_NBIN; b++ )
+      {
+         st[3*k  ] += HPL_blst.ncall[k][b];
+         st[3*k+1] += HPL_blst.time [k][b];
+         st[3*k+2] += HPL_blst.flops[k][b];
+         i = 3 * ( k * HPL_BLAS_NBIN + b );
+         hist[i  ] = HPL_blst.ncall[k][b];
+         hist[i+1] = HPL_blst.time [k][b];
+         hist[i+2] = HPL_blst.flops[k][b];
+      }
+   }
+   (void) HPL_reduce( (void *)(stats), nprocs * lstat, HPL_DOUBLE, HPL_sum,
+                      0, GRID->all_comm );
+   (void) HPL_reduce( (void *)(hist), 3 * HPL_BLAS_NFUN * HPL_BLAS_NBIN,
+                      HPL_DOUBLE, HPL_sum, 0, GRID->all_comm );
+
+   if( iam == 0 )
+   {
+      HPL_fprintf( TEST->outfp, "%s%s\n",
+                   "--BLAS--BLAS--BLAS--BLAS--BLAS--BLAS--BL",
+                   "AS--BLAS--BLAS--BLAS--BLAS--BLAS--BLAS--" );
+#ifdef HPL_CALL_DLBLAS
+      HPL_fprintf( TEST->outfp, "BLAS backend : %s\n", HPL_blas.name );
+#endif
+      HPL_fprintf( TEST->outfp, "%s%s\n",
+                   "Process Routine         Calls       Time (s)",
+                   "         Gflop       Gflops" );
+      for( p = 0; p < nprocs; p++ )
+      {
+         st = stats + p * lstat;
+         for( k = 0; k < HPL_BLAS_NFUN; k++ )
+         {
+            if( st[3*k] <= HPL_rzero ) continue;
+            HPL_fprintf( TEST->outfp,
+                         "%7d %-7s %13.0f %14.4f %13.4f %12.2f\n",
+                         p, name[k], st[3*k], st[3*k+1], 1.0e-9 * st[3*k+2],
+                         ( st[3*k+1] > HPL_rzero ?
+                           1.0e-9 * st[3*k+2] / st[3*k+1] : HPL_rzero ) );
+         }
+      }
+      HPL_fprintf( TEST->outfp, "%s%s\n",
+                   "Routine Min.dim         Calls       Time (s)",
+                   "         Gflop       Gflops" );
+      for( k = 0; k < HPL_BLAS_NFUN; k++ )
+      {
+         for( b = 0; b < HPL_BLAS_NBIN; b++ )
+         {
+            st = hist + 3 * ( k * HPL_BLAS_NBIN + b );
+            if( st[0] <= HPL_rzero ) continue;
+            HPL_fprintf( TEST->outfp,
+                         "%-7s %6d%c %13.0f %14.4f %13.4f %12.2f\n",
+                         name[k], 1 << b,
+                         ( b == HPL_BLAS_NBIN - 1 ? '+' : ' ' ), st[0],
+                         st[1], 1.0e-9 * st[2], ( st[1] > HPL_rzero ?
+                         1.0e-9 * st[2] / st[1] : HPL_rzero ) );
+         }
+      }
+   }
+   if( stats ) free( stats );
+/*
+ * End of HPL_pdblstat
+ */
+}
+
+#endif
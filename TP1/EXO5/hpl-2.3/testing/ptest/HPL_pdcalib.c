@@ -0,0 +1,202 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdcalib
+(
+   HPL_T_test *                     TEST,
+   HPL_T_grid *                     GRID,
+   const int                        NCW,
+   const int *                      CW
+)
+#else
+void HPL_pdcalib
+( TEST, GRID, NCW, CW )
+   HPL_T_test *                     TEST;
+   HPL_T_grid *                     GRID;
+   const int                        NCW;
+   const int *                      CW;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_pdcalib sets the weights of the column distribution of GRID: the
+ * process columns are given CW[q % NCW] blocks of every cycle, or, when
+ * CW[0] is 0,  a number proportional to their DGEMM rate.  Every process
+ * times products of order  HPL_CALIB_N  for HPL_CALIB_TIME seconds, all
+ * of them at once as in the factorization. A process column is as fast
+ * as its slowest process,  and the rates are scaled to at most  HPL_CA-
+ * LIB_RES  blocks  per cycle.  The weights are printed by process 0 of
+ * the grid. Without weights (NCW = 0) the columns stay block-cyclic.
+ *
+ * Arguments
+ * =========
+ *
+ * TEST    (global input)                HPL_T_test *
+ *         On entry,  TEST  points to the test data structure:  outfp is
+ *         the output file stream.
+ *
+ * GRID    (local input/output)          HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.  On exit, its column distribution
+ *         is weighted as described above.
+ *
+ * NCW     (global input)                const int
+ *         On entry, NCW specifies the number of weights in CW.
+ *
+ * CW      (global input)                const int *
+ *         On entry,  CW  is an array of dimension NCW containing the
+ *         weights of the process columns, or 0 to measure them.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   double                     * buf = NULL, * rate = NULL;
+   double                     rmax, t0, time;
+   int                        * wght = NULL;
+   int                        i, k, mycol, myrow, n = HPL_CALIB_N, ncyc,
+                              npcol, nprow;
+/* ..
+ * .. Executable Statements ..
+ */
+   (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
+   if( ( NCW <= 0 ) || ( npcol <= 1 ) )
+   { (void) HPL_grid_wght( GRID, NULL ); return; }
+
+   rate = (double *)malloc( (size_t)(npcol) * sizeof( double ) );
+   wght = (int    *)malloc( (size_t)(npcol) * sizeof( int    ) );
+   if( ( rate == NULL ) || ( wght == NULL ) )
+   { HPL_pabort( __LINE__, "HPL_pdcalib", "Memory allocation failed" ); }
+
+   if( CW[0] > 0 )
+   {
+      for( k = 0; k < npcol; k++ ) wght[k] = CW[k % NCW];
+   }
+   else
+   {
+/*
+ * Time the DGEMMs of all the processes together after one warm-up call
+ */
+      buf = (double *)malloc( (size_t)(3) * (size_t)(n) * (size_t)(n) *
+                              sizeof( double ) );
+      if( buf == NULL )
+      { HPL_pabort( __LINE__, "HPL_pdcalib", "Memory allocation failed" ); }
+      for( i = 0; i < 3 * n * n; i++ )
+         buf[i] = ( i < 2 * n * n ? 0.5 - (double)( i % 7 ) / 7.0 :
+                    HPL_rzero );
+
+      HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, n, n, n,
+                 HPL_rone, buf, n, buf+n*n, n, HPL_rzero, buf+2*n*n, n );
+      (void) HPL_barrier( GRID->all_comm );
+      t0 = HPL_timer_walltime(); k = 0;
+      do
+      {
+         HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, n, n, n,
+                    HPL_rone, buf, n, buf+n*n, n, HPL_rone, buf+2*n*n, n );
+         k++; time = HPL_timer_walltime() - t0;
+      } while( time < HPL_CALIB_TIME );
+      free( buf );
+/*
+ * Slowest process of every column,  then the rates of all the columns
+ * in every process
+ */
+      rate[0] = 2.0e-9 * (double)(n) * (double)(n) * (double)(n) *
+                (double)(k) / time;
+      (void) HPL_all_reduce( (void *)rate, 1, HPL_DOUBLE, HPL_min,
+                             GRID->col_comm );
+      t0 = rate[0];
+      for( k = 0; k < npcol; k++ ) rate[k] = HPL_rzero;
+      rate[mycol] = t0;
+      (void) HPL_all_reduce( (void *)rate, npcol, HPL_DOUBLE, HPL_sum,
+                             GRID->row_comm );
+
+      for( k = 0, rmax = HPL_rzero; k < npcol; k++ )
+         rmax = Mmax( rmax, rate[k] );
+      for( k = 0; k < npcol; k++ )
+      {
+         wght[k] = (int)( (double)(HPL_CALIB_RES) * rate[k] / rmax + 0.5 );
+         wght[k] = Mmax( 1, wght[k] );
+      }
+   }
+   ncyc = HPL_grid_wght( GRID, wght );
+/*
+ * Report the rates and weights
+ */
+   if( ( myrow == 0 ) && ( mycol == 0 ) )
+   {
+      if( CW[0] <= 0 )
+      {
+         HPL_fprintf( TEST->outfp, "\nProcess columns of the %d x %d grid,"
+                      " DGEMM Gflops :", nprow, npcol );
+         for( k = 0; k < npcol; k++ )
+            HPL_fprintf( TEST->outfp, "%s%9.2f", ( k % 8 == 0 ?
+                         "\n       " : " " ), rate[k] );
+      }
+      HPL_fprintf( TEST->outfp, "\nProcess columns of the %d x %d grid,"
+                   " weights      :", nprow, npcol );
+      for( k = 0; k < npcol; k++ )
+         HPL_fprintf( TEST->outfp, "%s%9d", ( k % 8 == 0 ? "\n       " :
+                      " " ), ( ncyc > 0 ? GRID->cwgt[k] : 1 ) );
+      if( ncyc > 0 )
+         HPL_fprintf( TEST->outfp, "\n       cycle of %d blocks\n\n",
+                      ncyc );
+      else
+         HPL_fprintf( TEST->outfp, "\n       block-cyclic\n\n" );
+   }
+   free( rate ); free( wght );
+/*
+ * End of HPL_pdcalib
+ */
+}
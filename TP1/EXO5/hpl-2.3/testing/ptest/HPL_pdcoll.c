@@ -0,0 +1,224 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+/*
+ * Message lengths in doubles,  and operations timed for each of them
+ */
+#define    HPL_COLL_NLEN         6
+#define    HPL_COLL_NOPS         3
+
+#ifdef STDC_HEADERS
+static double HPL_pdcoll_time
+(
+   const HPL_T_COLL                 COLL,
+   const int                        OPER,
+   const int                        COUNT,
+   const int                        NREP,
+   double *                         BUF,
+   MPI_Comm                         COMM
+)
+#else
+static double HPL_pdcoll_time( COLL, OPER, COUNT, NREP, BUF, COMM )
+   const HPL_T_COLL                 COLL;
+   const int                        OPER;
+   const int                        COUNT;
+   const int                        NREP;
+   double *                         BUF;
+   MPI_Comm                         COMM;
+#endif
+{
+/*
+ * Return the largest over COMM of the wall time per call of the colle-
+ * ctive operation OPER (0=broadcast,1=reduce,2=all_reduce) of COUNT
+ * doubles with the backend COLL. The maximum keeps the values bounded
+ * over the repetitions.
+ */
+   double                     t0 = HPL_rzero, time;
+   int                        i;
+
+   HPL_coll = COLL;
+   for( i = -2; i < NREP; i++ )
+   {
+      if( i == 0 ) { (void) MPI_Barrier( COMM ); t0 = MPI_Wtime(); }
+      if( OPER == 0 )
+         (void) HPL_broadcast( (void *)BUF, COUNT, HPL_DOUBLE, 0, COMM );
+      else if( OPER == 1 )
+         (void) HPL_reduce( (void *)BUF, COUNT, HPL_DOUBLE, HPL_max, 0,
+                            COMM );
+      else
+         (void) HPL_all_reduce( (void *)BUF, COUNT, HPL_DOUBLE, HPL_max,
+                                COMM );
+   }
+   time = ( MPI_Wtime() - t0 ) / (double)(NREP);
+   HPL_coll = HPL_COLL_TREE;
+
+   (void) MPI_Allreduce( MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, COMM );
+   return( time );
+}
+
+#ifdef STDC_HEADERS
+int main
+(
+   int                        ARGC,
+   char                       * * ARGV
+)
+#else
+int main( ARGC, ARGV )
+/*
+ * .. Scalar Arguments ..
+ */
+   int                        ARGC;
+/*
+ * .. Array Arguments ..
+ */
+   char                       * * ARGV;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * main is the driver of the latency microbenchmark of the collective
+ * operations  HPL_broadcast,  HPL_reduce  and  HPL_all_reduce.  For
+ * P = 2, 4, 8, ... up to the number of processes  and  for every mes-
+ * sage length,  the wall time per call on the first P processes  is
+ * measured with the HPL binomial trees and the native MPI collectives,
+ * and printed by process 0 with the ratio of both. The optional argu-
+ * ment is the number of repetitions of the shortest messages (1000 by
+ * default),  that is reduced in proportion for the longest ones.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   static const int           len[HPL_COLL_NLEN] =
+                              { 1, 8, 64, 512, 4096, 32768 };
+   static const char          * name[HPL_COLL_NOPS] =
+                              { "broadcast", "reduce", "all_reduce" };
+   MPI_Comm                   comm;
+   double                     tmpi, ttree;
+   double                     * buf = NULL;
+   int                        i, k, nrep, nrep0 = 1000, p, rank, size;
+/* ..
+ * .. Executable Statements ..
+ */
+   MPI_Init( &ARGC, &ARGV );
+   MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+   MPI_Comm_size( MPI_COMM_WORLD, &size );
+   if( ARGC > 1 ) nrep0 = Mmax( 1, atoi( ARGV[1] ) );
+
+   buf = (double *)malloc( (size_t)(len[HPL_COLL_NLEN-1]) *
+                           sizeof( double ) );
+   if( buf == NULL )
+   { HPL_pabort( __LINE__, "main", "Memory allocation failed" ); }
+   for( i = 0; i < len[HPL_COLL_NLEN-1]; i++ )
+      buf[i] = (double)( rank + i );
+
+   if( rank == 0 )
+   {
+      HPL_fprintf( stdout, "%s%s\n",
+                   "========================================",
+                   "========================================" );
+      HPL_fprintf( stdout, "%s\n",
+                   "Latency of the collectives, wall time per call in us" );
+      HPL_fprintf( stdout, "%s%s\n",
+                   "     P    COUNT  OPERATION         HPL trees",
+                   "           MPI    TREES/MPI" );
+      HPL_fprintf( stdout, "%s%s\n",
+                   "----------------------------------------",
+                   "----------------------------------------" );
+   }
+/*
+ * Powers of two up to the number of processes, and that number itself
+ */
+   p = Mmin( 2, size );
+   do
+   {
+      (void) MPI_Comm_split( MPI_COMM_WORLD, ( rank < p ? 0 :
+                             MPI_UNDEFINED ), rank, &comm );
+      if( comm != MPI_COMM_NULL )
+      {
+         for( i = 0; i < HPL_COLL_NLEN; i++ )
+         {
+            nrep = Mmax( 10, nrep0 / Mmax( 1, len[i] / 64 ) );
+            for( k = 0; k < HPL_COLL_NOPS; k++ )
+            {
+               ttree = HPL_pdcoll_time( HPL_COLL_TREE, k, len[i], nrep, buf,
+                                        comm );
+               tmpi  = HPL_pdcoll_time( HPL_COLL_MPI,  k, len[i], nrep, buf,
+                                        comm );
+               if( rank == 0 )
+                  HPL_fprintf( stdout,
+                               "%6d %8d  %-10s %14.2f %14.2f %12.2f\n",
+                               p, len[i], name[k], 1.0e+6 * ttree,
+                               1.0e+6 * tmpi, ( tmpi > HPL_rzero ?
+                               ttree / tmpi : HPL_rzero ) );
+            }
+         }
+         (void) MPI_Comm_free( &comm );
+      }
+      (void) MPI_Barrier( MPI_COMM_WORLD );
+      p = ( p < size ? Mmin( 2 * p, size ) : 0 );
+   } while( p > 0 );
+   if( rank == 0 )
+      HPL_fprintf( stdout, "%s%s\n",
+                   "========================================",
+                   "========================================" );
+
+   free( buf );
+   MPI_Finalize();
+   exit( 0 );
+
+   return( 0 );
+/*
+ * End of main
+ */
+}
@@ -0,0 +1,220 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+/*
+ * Shapes timed:  M x N copies of the jb x jb triangle L1 and of the jb
+ * rows of U, with jb the blocking factor
+ */
+#define    HPL_COPY_NSHP          10
+
+#ifdef STDC_HEADERS
+static double HPL_pdcopy_time
+(
+   const int                        KERN,
+   const int                        M,
+   const int                        N,
+   const double *                   A,
+   const int                        LDA,
+   double *                         B,
+   const int                        LDB,
+   MPI_Comm                         COMM
+)
+#else
+static double HPL_pdcopy_time( KERN, M, N, A, LDA, B, LDB, COMM )
+   const int                        KERN;
+   const int                        M;
+   const int                        N;
+   const double *                   A;
+   const int                        LDA;
+   double *                         B;
+   const int                        LDB;
+   MPI_Comm                         COMM;
+#endif
+{
+/*
+ * Return the largest over COMM of the wall time per call of the M x N
+ * copy KERN:  0 = HPL_dlacpy,  1 = HPL_dlatcpy,  2 = transpose by a
+ * plain double loop.  All processes copy at the same time,  so that the
+ * memory bandwidth of a node is shared as during the factorization.
+ */
+   double                     t0 = HPL_rzero, time;
+   int                        i, j, k, nrep;
+
+   nrep = Mmax( 4, ( 1 << 24 ) / Mmax( 1, M * N ) );
+   for( k = -1; k < nrep; k++ )
+   {
+      if( k == 0 ) { (void) MPI_Barrier( COMM ); t0 = MPI_Wtime(); }
+      if(      KERN == 0 ) HPL_dlacpy(  M, N, A, LDA, B, LDB );
+      else if( KERN == 1 ) HPL_dlatcpy( M, N, A, LDA, B, LDB );
+      else
+      {
+         for( j = 0; j < N; j++ )
+         { for( i = 0; i < M; i++ ) B[i+(size_t)(j)*LDB] =
+                                    A[j+(size_t)(i)*LDA]; }
+      }
+   }
+   time = ( MPI_Wtime() - t0 ) / (double)(nrep);
+
+   (void) MPI_Allreduce( MPI_IN_PLACE, &time, 1, MPI_DOUBLE, MPI_MAX, COMM );
+   return( time );
+}
+
+#ifdef STDC_HEADERS
+int main
+(
+   int                        ARGC,
+   char                       * * ARGV
+)
+#else
+int main( ARGC, ARGV )
+/*
+ * .. Scalar Arguments ..
+ */
+   int                        ARGC;
+/*
+ * .. Array Arguments ..
+ */
+   char                       * * ARGV;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * main is the driver of the microbenchmark of the copies performed by
+ * the update when U is stored  in no-transposed form  (HPL_dlacpy)  or
+ * in transposed form  (HPL_dlatcpy),  and by the panel factorizations
+ * for  L1.  For the  jb x jb  blocks  and  the  jb x N  rows of U of the
+ * shapes below,  the rate in GB/s  of HPL_dlacpy,  HPL_dlatcpy  and  a
+ * plain transpose loop is printed by process 0,  with the ratio of the
+ * transposed over the no-transposed copy.  Every process runs the copies
+ * at the same time. The transpose computed by HPL_dlatcpy is checked
+ * against the plain loop.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   static const int           mshp[HPL_COPY_NSHP] =
+                              { 32, 64, 128, 256, 32, 64, 128, 256, 64,
+                                256 },
+                              nshp[HPL_COPY_NSHP] =
+                              { 32, 64, 128, 256, 4000, 4000, 4000, 4000,
+                                20000, 8000 };
+   double                     * A = NULL, * B = NULL, * C = NULL;
+   double                     gb, tn, tr, tt;
+   size_t                     len;
+   int                        i, k, m, n, nerr, rank;
+/* ..
+ * .. Executable Statements ..
+ */
+   MPI_Init( &ARGC, &ARGV );
+   MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+
+   for( k = 0, len = 0; k < HPL_COPY_NSHP; k++ )
+      len = Mmax( len, (size_t)(mshp[k]) * (size_t)(nshp[k]) );
+   A = (double *)malloc( len * sizeof( double ) );
+   B = (double *)malloc( len * sizeof( double ) );
+   C = (double *)malloc( len * sizeof( double ) );
+   if( ( A == NULL ) || ( B == NULL ) || ( C == NULL ) )
+   { HPL_pabort( __LINE__, "main", "Memory allocation failed" ); }
+   for( i = 0; i < (int)(len); i++ ) A[i] = (double)( i % 1021 - rank );
+
+   if( rank == 0 )
+   {
+      HPL_fprintf( stdout, "%s%s\n",
+                   "========================================",
+                   "========================================" );
+      HPL_fprintf( stdout, "%s\n",
+                   "Copy rates in GB/s (bytes read and written per second)" );
+      HPL_fprintf( stdout, "%s%s\n",
+                   "       M       N     dlacpy    dlatcpy  plain loop",
+                   "     TRANS/NOTRANS" );
+      HPL_fprintf( stdout, "%s%s\n",
+                   "----------------------------------------",
+                   "----------------------------------------" );
+   }
+/*
+ * B is M x N: A is M x N for HPL_dlacpy and N x M for the transposes
+ */
+   for( k = 0, nerr = 0; k < HPL_COPY_NSHP; k++ )
+   {
+      m = mshp[k]; n = nshp[k];
+      tn = HPL_pdcopy_time( 0, m, n, A, m, B, m, MPI_COMM_WORLD );
+      tr = HPL_pdcopy_time( 2, m, n, A, n, C, m, MPI_COMM_WORLD );
+      tt = HPL_pdcopy_time( 1, m, n, A, n, B, m, MPI_COMM_WORLD );
+      for( i = 0; i < m * n; i++ ) nerr += ( B[i] != C[i] );
+
+      gb = 2.0e-9 * (double)(m) * (double)(n) * sizeof( double );
+      if( rank == 0 )
+         HPL_fprintf( stdout, "%8d%8d %10.2f %10.2f  %10.2f %17.2f\n",
+                      m, n, gb / tn, gb / tt, gb / tr, tn / tt );
+   }
+   (void) MPI_Allreduce( MPI_IN_PLACE, &nerr, 1, MPI_INT, MPI_SUM,
+                         MPI_COMM_WORLD );
+   if( rank == 0 )
+   {
+      HPL_fprintf( stdout, "%s%s\n",
+                   "========================================",
+                   "========================================" );
+      HPL_fprintf( stdout, "%s %s\n", "HPL_dlatcpy check",
+                   ( nerr == 0 ? "PASSED" : "FAILED" ) );
+   }
+
+   free( C ); free( B ); free( A );
+   MPI_Finalize();
+   exit( nerr != 0 );
+
+   return( nerr != 0 );
+/*
+ * End of main
+ */
+}
@@ -73,13 +73,16 @@ int main( ARGC, ARGV )
  *
  * main is the main driver program for testing the HPL routines.
  * This  program is  driven  by  a short data file named  "HPL.dat".
+ * The command line may name another input file,  in that format or as
+ * KEY = VALUE lines,  and override its parameters with KEY=VALUE argu-
+ * ments (see HPL_pdinput).
  *
  * ---------------------------------------------------------------------
  */ 
 /*
  * .. Local Variables ..
  */
-   int                        nval  [HPL_MAX_PARAM],
+   int                        * nval = NULL,
                               nbval [HPL_MAX_PARAM],
                               pval  [HPL_MAX_PARAM],
                               qval  [HPL_MAX_PARAM],
@@ -95,18 +98,41 @@ int main( ARGC, ARGV )
    HPL_T_grid                 grid;
    HPL_T_palg                 algo;
    HPL_T_test                 test;
+   MPI_Comm                   gcomm, rcomm;
+   double                     gres[4], nscal, * gall = NULL, * sres = NULL;
    int                        L1notran, Unotran, align, equil, in, inb,
                               inbm, indh, indv, ipfa, ipq, irfa, itop,
                               mycol, myrow, ns, nbs, nbms, ndhs, ndvs,
                               npcol, npfs, npqs, nprow, nrfs, ntps, 
-                              rank, size, tswap;
+                              bprec, ckpt, icomb, igrp, k, kcnt[3], n,
+                              ncomb, ncw, ngrp, nrhs, nthrd, ooc, rank,
+                              size, sweep, tswap, cwval[HPL_MAX_PARAM];
+#ifdef HPL_USE_PTHREADS
+   int                        provided;
+#endif
    HPL_T_ORDER                pmapping;
    HPL_T_FACT                 rpfa;
    HPL_T_SWAP                 fswap;
+   HPL_T_ENGINE               engine;
+   HPL_T_COLL                 coll;
+   char                       blas[HPL_LINE_MAX], ckptf[HPL_LINE_MAX],
+                              oocf[HPL_LINE_MAX];
+#ifdef HPL_CALL_DLBLAS
+   int                        ierr;
+#endif
 /* ..
  * .. Executable Statements ..
  */
+#ifdef HPL_USE_PTHREADS
+/*
+ * Worker threads never call MPI, only the main thread does.  Without
+ * that support, no other thread is started.
+ */
+   MPI_Init_thread( &ARGC, &ARGV, MPI_THREAD_FUNNELED, &provided );
+   if( provided < MPI_THREAD_FUNNELED ) HPL_thrd = 0;
+#else
    MPI_Init( &ARGC, &ARGV );
+#endif
 #ifdef HPL_CALL_VSIPL
    vsip_init((void*)0);
 #endif
@@ -146,23 +172,126 @@ int main( ARGC, ARGV )
  * 0            U  in (0=transposed,1=no-transposed) form
  * 1            Equilibration (0=no,1=yes)
  * 8            memory alignment in double (> 0)
+ * 0            LU engine (0=look-ahead pipeline,1=task graph) [optional]
+ * builtin      BLAS backend (builtin or path of a CBLAS library) [optional]
+ * 0            checkpoint every that many panels (0=off) [optional]
+ * hpl.ckpt     checkpoint file prefix [optional]
+ * 0            out-of-core memory window in MB per process (0=off) [optional]
+ * hpl.ooc      out-of-core file prefix [optional]
+ * 0            L broadcast precision (0=double,1=single+refinement) [optional]
+ * 0            # of right-hand sides solved with the factors [optional]
+ * 0            collectives (0=HPL trees,1=MPI) [optional]
+ * 0            scaling sweep (0=off,1=strong,2=weak) [optional]
+ * 1            # of concurrent instances [optional]
+ * 0            # of column weights (0=uniform) [optional]
+ * 0            column weights (0=DGEMM calibration) [optional]
  */
-   HPL_pdinfo( &test, &ns, nval, &nbs, nbval, &pmapping, &npqs, pval, qval,
+   HPL_pdinfo( &test, &ns, &nval, &nbs, nbval, &pmapping, &npqs, pval, qval,
                &npfs, pfaval, &nbms, nbmval, &ndvs, ndvval, &nrfs, rfaval,
                &ntps, topval, &ndhs, ndhval, &fswap, &tswap, &L1notran,
-               &Unotran, &equil, &align );
+               &Unotran, &equil, &align, &nthrd, &engine, blas, &ckpt,
+               ckptf, &ooc, oocf, &bprec, &nrhs, &coll, &sweep,
+               &ngrp, &ncw, cwval, ARGC, ARGV );
+#ifdef HPL_USE_PTHREADS
+   if( !HPL_thrd )
+   {
+      if( rank == 0 )
+         HPL_pwarn( test.outfp, __LINE__, "main", "%s %s",
+                    "MPI does not provide MPI_THREAD_FUNNELED,",
+                    "using 1 thread per process and no helper thread" );
+      nthrd = 1;
+   }
+#endif
+/*
+ * Select the backend of the collective operations from now on
+ */
+   HPL_coll = coll;
+#ifdef HPL_CALL_DLBLAS
+/*
+ * Select the BLAS backend,  the same on every process: if any process
+ * cannot load the library, all of them use the built-in kernels.
+ */
+   ierr = HPL_blas_init( blas );
+   (void) HPL_all_reduce( (void *)(&ierr), 1, HPL_INT, HPL_min,
+                          MPI_COMM_WORLD );
+   if( ierr != HPL_SUCCESS )
+   {
+      (void) HPL_blas_init( "builtin" );
+      if( rank == 0 )
+         HPL_pwarn( test.outfp, __LINE__, "main", "%s %s, %s",
+                    "Cannot load the BLAS library", blas,
+                    "using the built-in kernels instead" );
+   }
+#endif
+/*
+ * Concurrent instances: the processes of instance igrp are the ranks
+ * igrp*size/ngrp to (igrp+1)*size/ngrp-1 of MPI_COMM_WORLD, that make
+ * up gcomm;  the remaining ones are idle. The first process of every
+ * instance belongs to rcomm, on which the results of every test are
+ * gathered by process 0.  It is the only one printing.  The checkpoint
+ * and out-of-core files of every instance have a suffix of their own.
+ */
+   gcomm = MPI_COMM_WORLD; rcomm = MPI_COMM_NULL; igrp = 0;
+   if( ngrp > 1 )
+   {
+      igrp = rank / ( size / ngrp );
+      (void) MPI_Comm_split( MPI_COMM_WORLD, ( igrp < ngrp ? igrp :
+                             MPI_UNDEFINED ), rank, &gcomm );
+      (void) MPI_Comm_split( MPI_COMM_WORLD, ( ( igrp < ngrp ) &&
+                             ( rank % ( size / ngrp ) == 0 ) ? 0 :
+                             MPI_UNDEFINED ), rank, &rcomm );
+      if( strlen( ckptf ) < HPL_LINE_MAX - 16 )
+         (void) sprintf( ckptf + strlen( ckptf ), ".g%d", igrp );
+      if( strlen( oocf ) < HPL_LINE_MAX - 16 )
+         (void) sprintf( oocf + strlen( oocf ), ".g%d", igrp );
+      if( rank == 0 )
+      {
+         gall = (double *)malloc( (size_t)(4 * ngrp) * sizeof( double ) );
+         if( gall == NULL )
+         { HPL_pabort( __LINE__, "main", "Memory allocation failed" ); }
+      }
+   }
+/*
+ * In a scaling sweep,  process 0 records  N, NB,  the time and Gflops of
+ * every combination of the parameters on every grid.
+ */
+   ncomb = ns * nbs * ndhs * ntps * nrfs * npfs * nbms * ndvs;
+   if( ( sweep != 0 ) && ( rank == 0 ) )
+   {
+      sres = (double *)malloc( (size_t)(4 * npqs) * (size_t)(ncomb) *
+                               sizeof( double ) );
+      if( sres == NULL )
+      { HPL_pabort( __LINE__, "main", "Memory allocation failed" ); }
+   }
 /*
  * Loop over different process grids - Define process grid. Go to bottom
  * of process grid loop if this case does not use my process.
  */
    for( ipq = 0; ipq < npqs; ipq++ )
    {
-      (void) HPL_grid_init( MPI_COMM_WORLD, pmapping, pval[ipq], qval[ipq],
-                            &grid );
+      if( gcomm == MPI_COMM_NULL ) goto label_end_of_npqs;
+      (void) HPL_grid_init( gcomm, pmapping, pval[ipq], qval[ipq], &grid );
       (void) HPL_grid_info( &grid, &nprow, &npcol, &myrow, &mycol );
 
       if( ( myrow < 0 ) || ( myrow >= nprow ) ||
           ( mycol < 0 ) || ( mycol >= npcol ) ) goto label_end_of_npqs;
+/*
+ * Weight the distribution of the columns over the process columns,  as
+ * given or measured on this grid.
+ */
+      HPL_pdcalib( &test, &grid, ncw, cwval );
+/*
+ * In a weak scaling sweep,  N grows as the square root of the number of
+ * processes, so that the memory per process stays the same.
+ */
+      nscal = HPL_rone;
+      if( sweep == 2 )
+      {
+         nscal = 0.5 * (double)(nprow * npcol + 1);
+         for( k = 0; k < 32; k++ )
+            nscal = 0.5 * ( nscal + (double)(nprow * npcol) / nscal );
+      }
+      icomb = 0;
 
       for( in = 0; in < ns; in++ )
       {                            /* Loop over various problem sizes */
@@ -192,6 +321,7 @@ int main( ARGC, ARGV )
               {
                  if( rpfa == HPL_LEFT_LOOKING ) algo.pffun = HPL_pdpanllN;
                  else if( rpfa == HPL_CROUT   ) algo.pffun = HPL_pdpancrN;
+                 else if( rpfa == HPL_RECURSIVE ) algo.pffun = HPL_pdpanrrN;
                  else                           algo.pffun = HPL_pdpanrlN;
 
                  algo.rfact = rpfa = rfaval[irfa];
@@ -206,6 +336,7 @@ int main( ARGC, ARGV )
               {
                  if( rpfa == HPL_LEFT_LOOKING ) algo.pffun = HPL_pdpanllT;
                  else if( rpfa == HPL_CROUT   ) algo.pffun = HPL_pdpancrT;
+                 else if( rpfa == HPL_RECURSIVE ) algo.pffun = HPL_pdpanrrT;
                  else                           algo.pffun = HPL_pdpanrlT;
 
                  algo.rfact = rpfa = rfaval[irfa];
@@ -219,8 +350,33 @@ int main( ARGC, ARGV )
 
               algo.fswap = fswap; algo.fsthr = tswap;
               algo.equil = equil; algo.align = align;
+              algo.nthrd = nthrd; algo.engine = engine;
+              algo.ckpt  = ckpt;  algo.ckptf  = ckptf;
+              algo.ooc   = ooc;   algo.oocf   = oocf;
+              algo.bprec = bprec; algo.nrhs   = nrhs;
 
-              HPL_pdtest( &test, &grid, &algo, nval[in], nbval[inb] );
+              n = (int)( nscal * (double)(nval[in]) + 0.5 );
+              kcnt[0] = test.kpass; kcnt[1] = test.kfail;
+              HPL_pdtest( &test, &grid, &algo, n, nbval[inb] );
+
+              if( rcomm != MPI_COMM_NULL )
+              {
+                 gres[0] = test.wtime; gres[1] = test.gflops;
+                 gres[2] = (double)(test.kpass - kcnt[0]);
+                 gres[3] = (double)(test.kfail - kcnt[1]);
+                 (void) MPI_Gather( gres, 4, MPI_DOUBLE, gall, 4, MPI_DOUBLE,
+                                    0, rcomm );
+                 if( rank == 0 ) HPL_pdgroup( &test, ngrp, size, gall );
+              }
+
+              if( sres != NULL )
+              {
+                 sres[4*(ipq*ncomb+icomb)  ] = (double)(n);
+                 sres[4*(ipq*ncomb+icomb)+1] = (double)(nbval[inb]);
+                 sres[4*(ipq*ncomb+icomb)+2] = test.wtime;
+                 sres[4*(ipq*ncomb+icomb)+3] = test.gflops;
+              }
+              icomb++;
 
              }
             }
@@ -236,6 +392,26 @@ label_end_of_npqs: ;
 /*
  * Print ending messages, close output file, exit.
  */
+   if( sres != NULL )
+   {
+      HPL_pdsweep( &test, sweep, npqs, pval, qval, ncomb, sres );
+      free( sres );
+   }
+/*
+ * Count the tests of all instances
+ */
+   if( rcomm != MPI_COMM_NULL )
+   {
+      kcnt[0] = test.kpass; kcnt[1] = test.kfail; kcnt[2] = test.kskip;
+      (void) MPI_Allreduce( MPI_IN_PLACE, kcnt, 3, MPI_INT, MPI_SUM, rcomm );
+      test.kpass = kcnt[0]; test.kfail = kcnt[1]; test.kskip = kcnt[2];
+      (void) MPI_Comm_free( &rcomm );
+   }
+   if( ( gcomm != MPI_COMM_WORLD ) && ( gcomm != MPI_COMM_NULL ) )
+      (void) MPI_Comm_free( &gcomm );
+   if( gall ) free( gall );
+   if( nval ) free( nval );
+
    if( rank == 0 )
    {
       test.ktest = test.kpass + test.kfail + test.kskip;
@@ -282,6 +458,9 @@ label_end_of_npqs: ;
    }
 #ifdef HPL_CALL_VSIPL
    vsip_finalize((void*)0);
+#endif
+#ifdef HPL_CALL_DLBLAS
+   HPL_blas_exit();
 #endif
    MPI_Finalize();
    exit( 0 );
@@ -0,0 +1,168 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdgroup
+(
+   HPL_T_test *                     TEST,
+   const int                        NGRP,
+   const int                        SIZE,
+   const double *                   RES
+)
+#else
+void HPL_pdgroup
+( TEST, NGRP, SIZE, RES )
+   HPL_T_test *                     TEST;
+   const int                        NGRP;
+   const int                        SIZE;
+   const double *                   RES;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdgroup prints the results of a test run concurrently by NGRP
+ * instances:  the time,  the Gflops and the outcome of the check  of
+ * every instance,  the aggregate rate,  and a summary of the spread of
+ * the rates across the instances,  listing as outliers the instances
+ * slower than the mean by more than HPL_GROUP_TOL.
+ *
+ * Arguments
+ * =========
+ *
+ * TEST    (global input)                HPL_T_test *
+ *         On entry,  TEST  points  to the test data structure:  outfp is
+ *         the output file stream  and thrsh the threshold of the resid-
+ *         ual check.
+ *
+ * NGRP    (global input)                const int
+ *         On entry, NGRP specifies the number of instances.
+ *
+ * SIZE    (global input)                const int
+ *         On entry,  SIZE  specifies the number of processes,  that are
+ *         split in NGRP instances of SIZE/NGRP processes each.
+ *
+ * RES     (global input)                const double *
+ *         On entry,  RES  is an array of dimension 4*NGRP.  Entry 4*k and
+ *         the next three contain the wall time,  the Gflops,  the number
+ *         of tests passed and the number of tests failed of instance k.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   const char                 * ck;
+   double                     gmax, gmean, gmin, gsum, tmax;
+   int                        k, nout, nrun, npi;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( NGRP <= 1 ) return;
+   npi = SIZE / NGRP;
+
+   HPL_fprintf( TEST->outfp, "%s%s\n",
+                "----------------------------------------",
+                "----------------------------------------" );
+   HPL_fprintf( TEST->outfp, "%s%s\n",
+                "Instance     Ranks                 Time",
+                "                 Gflops   Check" );
+
+   gsum = gmean = gmax = tmax = HPL_rzero; gmin = HPL_rzero; nrun = 0;
+   for( k = 0; k < NGRP; k++ )
+   {
+      if(      RES[4*k+3] > HPL_rzero ) ck = "FAILED";
+      else if( RES[4*k+2] <= HPL_rzero ) ck = "skipped";
+      else if( TEST->thrsh > HPL_rzero ) ck = "PASSED";
+      else                               ck = "done";
+
+      HPL_fprintf( TEST->outfp, "%8d %5d-%-5d %18.2f    %19.4e   %s\n",
+                   k, k * npi, ( k + 1 ) * npi - 1, RES[4*k],
+                   RES[4*k+1], ck );
+      if( RES[4*k] <= HPL_rzero ) continue;
+
+      gmin  = ( nrun == 0 ? RES[4*k+1] : Mmin( gmin, RES[4*k+1] ) );
+      gmax  = Mmax( gmax, RES[4*k+1] ); gsum += RES[4*k+1];
+      tmax  = Mmax( tmax, RES[4*k] );   nrun++;
+   }
+   if( nrun > 0 ) gmean = gsum / (double)(nrun);
+/*
+ * Aggregate rate, spread of the rates and outliers
+ */
+   HPL_fprintf( TEST->outfp, "%-20s %18.2f    %19.4e   %d/%d %s\n",
+                "Aggregate", tmax, gsum, nrun, NGRP, "instances" );
+   HPL_fprintf( TEST->outfp, "%s %11.4e, %s %11.4e, %s %11.4e\n",
+                "Gflops per instance: min", gmin, "mean", gmean, "max",
+                gmax );
+
+   nout = 0;
+   for( k = 0; k < NGRP; k++ )
+   {
+      if( ( RES[4*k] <= HPL_rzero ) ||
+          ( RES[4*k+1] >= ( HPL_rone - HPL_GROUP_TOL ) * gmean ) ) continue;
+      HPL_fprintf( TEST->outfp, "%s %d (ranks %d-%d) %s %.1f%% %s\n",
+                   "Outlier: instance", k, k * npi, ( k + 1 ) * npi - 1,
+                   "is", 100.0 * ( HPL_rone - RES[4*k+1] / gmean ),
+                   "slower than the mean" );
+      nout++;
+   }
+   if( nout == 0 )
+      HPL_fprintf( TEST->outfp, "%s %.1f%% %s\n",
+                   "No instance is more than", 100.0 * HPL_GROUP_TOL,
+                   "slower than the mean" );
+   HPL_fprintf( TEST->outfp, "%s%s\n",
+                "----------------------------------------",
+                "----------------------------------------" );
+/*
+ * End of HPL_pdgroup
+ */
+}
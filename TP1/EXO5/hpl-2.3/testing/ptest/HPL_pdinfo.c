@@ -54,7 +54,7 @@ void HPL_pdinfo
 (
    HPL_T_test *                     TEST,
    int *                            NS,
-   int *                            N,
+   int * *                          N,
    int *                            NBS,
    int *                            NB,
    HPL_T_ORDER *                    PMAPPIN,
@@ -78,14 +78,30 @@ void HPL_pdinfo
    int *                            L1NOTRAN,
    int *                            UNOTRAN,
    int *                            EQUIL,
-   int *                            ALIGN
+   int *                            ALIGN,
+   int *                            NTHRD,
+   HPL_T_ENGINE *                   ENGINE,
+   char *                           BLAS,
+   int *                            CKPT,
+   char *                           CKPTF,
+   int *                            OOC,
+   char *                           OOCF,
+   int *                            BPREC,
+   int *                            NRHS,
+   HPL_T_COLL *                     COLL,
+   int *                            SWEEP,
+   int *                            NGRP,
+   int *                            NCW,
+   int *                            CW,
+   const int                        ARGC,
+   char * *                         ARGV
 )
 #else
 void HPL_pdinfo
-( TEST, NS, N, NBS, NB, PMAPPIN, NPQS, P, Q, NPFS, PF, NBMS, NBM, NDVS, NDV, NRFS, RF, NTPS, TP, NDHS, DH, FSWAP, TSWAP, L1NOTRAN, UNOTRAN, EQUIL, ALIGN )
+( TEST, NS, N, NBS, NB, PMAPPIN, NPQS, P, Q, NPFS, PF, NBMS, NBM, NDVS, NDV, NRFS, RF, NTPS, TP, NDHS, DH, FSWAP, TSWAP, L1NOTRAN, UNOTRAN, EQUIL, ALIGN, NTHRD, ENGINE, BLAS, CKPT, CKPTF, OOC, OOCF, BPREC, NRHS, COLL, SWEEP, NGRP, NCW, CW, ARGC, ARGV )
    HPL_T_test *                     TEST;
    int *                            NS;
-   int *                            N;
+   int * *                          N;
    int *                            NBS;
    int *                            NB;
    HPL_T_ORDER *                    PMAPPIN;
@@ -110,6 +126,22 @@ void HPL_pdinfo
    int *                            UNOTRAN;
    int *                            EQUIL;
    int *                            ALIGN;
+   int *                            NTHRD;
+   HPL_T_ENGINE *                   ENGINE;
+   char *                           BLAS;
+   int *                            CKPT;
+   char *                           CKPTF;
+   int *                            OOC;
+   char *                           OOCF;
+   int *                            BPREC;
+   int *                            NRHS;
+   HPL_T_COLL *                     COLL;
+   int *                            SWEEP;
+   int *                            NGRP;
+   int *                            NCW;
+   int *                            CW;
+   const int                        ARGC;
+   char * *                         ARGV;
 #endif
 {
 /* 
@@ -134,12 +166,12 @@ void HPL_pdinfo
  *
  * NS      (global output)               int *
  *         On exit,  NS  specifies the number of different problem sizes
- *         to be tested. NS is less than or equal to HPL_MAX_PARAM.
+ *         to be tested.
  *
- * N       (global output)               int *
- *         On entry, N is an array of dimension HPL_MAX_PARAM.  On exit,
- *         the first NS entries of this array contain the  problem sizes
- *         to run the code with.
+ * N       (global output)               int * *
+ *         On exit,  *N  points to an array of dimension NS allocated with
+ *         malloc,  that contains the problem sizes to run the code with.
+ *         It is to be freed by the caller.
  *
  * NBS     (global output)               int *
  *         On exit,  NBS  specifies the number of different distribution
@@ -263,6 +295,100 @@ void HPL_pdinfo
  *         allocated buffers in double precision words. ALIGN is greater
  *         than zero.
  *
+ * NTHRD   (global output)               int *
+ *         On exit,  NTHRD  specifies the number of threads to be used in
+ *         every process. It is read from the environment variable
+ *         HPL_NUM_THREADS and defaults to 1. NTHRD is greater than zero.
+ *
+ * ENGINE  (global output)               HPL_T_ENGINE *
+ *         On exit,  ENGINE  specifies the factorization engine: the look-
+ *         ahead pipeline (HPL_ENG_PIPE) or the task graph executed by a
+ *         pool of NTHRD threads (HPL_ENG_DAG).  This input line is op-
+ *         tional and defaults to HPL_ENG_PIPE.
+ *
+ * BLAS    (global output)               char *
+ *         On entry, BLAS is an array of dimension HPL_LINE_MAX. On exit,
+ *         BLAS names the BLAS backend selected at run time,  "builtin"
+ *         or the path of a shared library exporting the C interface of
+ *         the BLAS.  This input line is optional  and defaults to
+ *         "builtin". It is overridden by the environment variable
+ *         HPL_BLAS. It is only used when HPL is compiled with
+ *         HPL_CALL_DLBLAS.
+ *
+ * CKPT    (global output)               int *
+ *         On exit,  CKPT  specifies the number of panels between  two
+ *         checkpoints of the look-ahead factorization, 0 disabling the
+ *         checkpoints.  This input line is optional and defaults to 0.
+ *
+ * CKPTF   (global output)               char *
+ *         On entry, CKPTF is an array of dimension HPL_LINE_MAX.  On
+ *         exit, CKPTF is the prefix of the checkpoint file names, com-
+ *         pleted by the process rank and the checkpoint slot.  This
+ *         input line is optional and defaults to "hpl.ckpt".
+ *
+ * OOC     (global output)               int *
+ *         On exit, OOC specifies the memory window in MB per process of
+ *         the out-of-core factorization,  0 keeping the matrix in core.
+ *         This input line is optional and defaults to 0.
+ *
+ * OOCF    (global output)               char *
+ *         On entry, OOCF is an array of dimension HPL_LINE_MAX. On exit,
+ *         OOCF is the prefix of the files backing the local matrices in
+ *         out-of-core mode,  completed by the process rank.  This
+ *         input line is optional and defaults to "hpl.ooc".
+ *
+ * BPREC   (global output)               int *
+ *         On exit, BPREC specifies the precision of L2 in the panel
+ *         broadcast, 0 for double and 1 for single precision followed
+ *         by the iterative refinement of the solution,  that cannot be
+ *         combined with checkpoints (CKPT > 0).  This input line is op-
+ *         tional and defaults to 0.
+ *
+ * NRHS    (global output)               int *
+ *         On exit,  NRHS  specifies the number of right-hand sides sol-
+ *         ved at once with the factors  after  every test, or 0 for none.
+ *         This input line is optional and defaults to 0.
+ *
+ * COLL    (global output)               HPL_T_COLL *
+ *         On exit,  COLL  specifies the backend of the collective opera-
+ *         tions  HPL_broadcast,  HPL_reduce and HPL_all_reduce, the HPL
+ *         binomial trees or the native  MPI  collectives.  This input
+ *         line is optional and defaults to the HPL trees.
+ *
+ * SWEEP   (global output)               int *
+ *         On exit,  SWEEP  is 0,  or 1 and 2 for a strong and weak scal-
+ *         ing sweep,  in which case  the  grids read are replaced by the
+ *         most square grids of  1, 2, 4, ...  processes up to the number
+ *         of processes of an instance.  This input line is optional and
+ *         defaults to 0.
+ *
+ * NGRP    (global output)               int *
+ *         On exit,  NGRP  specifies the number of instances of the tests
+ *         run concurrently, each by the size/NGRP processes of its own
+ *         part of MPI_COMM_WORLD.  This input line is optional and  de-
+ *         faults to 1.
+ *
+ * NCW     (global output)               int *
+ *         On exit,  NCW  specifies the number of column weights in  CW,
+ *         0 for the block-cyclic distribution of the columns.  NCW  is
+ *         less than or equal to HPL_MAX_PARAM.  This input line is op-
+ *         tional and defaults to 0.
+ *
+ * CW      (global output)               int *
+ *         On entry,  CW  is an array of dimension HPL_MAX_PARAM. On exit,
+ *         process column q owns CW[q % NCW] blocks of every cycle of the
+ *         weighted column distribution, or the weights are measured by a
+ *         short DGEMM calibration when CW[0] is 0 (see HPL_pdcalib). The
+ *         last two input lines are optional.
+ *
+ * ARGC    (local input)                 const int
+ *         On entry, ARGC specifies the number of arguments in ARGV.
+ *
+ * ARGV    (local input)                 char * *
+ *         On entry,  ARGV  is an array of dimension ARGC containing the
+ *         command line arguments. The input file and the KEY=VALUE over-
+ *         rides of the parameters are taken from them by HPL_pdinput.
+ *
  * ---------------------------------------------------------------------
  */ 
 /*
@@ -270,11 +396,11 @@ void HPL_pdinfo
  */
    char                       file[HPL_LINE_MAX], line[HPL_LINE_MAX],
                               auth[HPL_LINE_MAX], num [HPL_LINE_MAX];
-   FILE                       * infp;
+   FILE                       * infp = NULL;
    int                        * iwork = NULL;
    char                       * lineptr;
-   int                        error=0, fid, i, j, lwork, maxp, nprocs,
-                              rank, size;
+   int                        error=0, fid, i, j, lwork, maxp, nblas,
+                              nckpt, nooc, nprocs, rank, size;
 /* ..
  * .. Executable Statements ..
  */
@@ -285,6 +411,7 @@ void HPL_pdinfo
  */
    TEST->outfp = stderr; TEST->epsil = 2.0e-16; TEST->thrsh = 16.0;
    TEST->kfail = TEST->kpass = TEST->kskip = TEST->ktest = 0;
+   TEST->wtime = TEST->gflops = HPL_rzero;
 /*
  * Process 0 reads the input data, broadcasts to other processes and
  * writes needed information to TEST->outfp.
@@ -292,14 +419,11 @@ void HPL_pdinfo
    if( rank == 0 )
    {
 /*
- * Open file and skip data file header
+ * Open file, HPL.dat or as given by the command line, and skip data file
+ * header
  */
-      if( ( infp = fopen( "HPL.dat", "r" ) ) == NULL )
-      { 
-         HPL_pwarn( stderr, __LINE__, "HPL_pdinfo",
-                    "cannot open file HPL.dat" );
-         error = 1; goto label_error;
-      }
+      if( ( infp = HPL_pdinput( ARGC, ARGV ) ) == NULL )
+      { error = 1; goto label_error; }
 
       (void) fgets( line, HPL_LINE_MAX - 2, infp );
       (void) fgets( auth, HPL_LINE_MAX - 2, infp );
@@ -326,25 +450,33 @@ void HPL_pdinfo
  */
       (void) fgets( line, HPL_LINE_MAX - 2, infp ); 
       (void) sscanf( line, "%s", num ); *NS = atoi( num );
-      if( ( *NS < 1 ) || ( *NS > HPL_MAX_PARAM ) )
+      if( *NS < 1 )
       {
-         HPL_pwarn( stderr, __LINE__, "HPL_pdinfo", "%s %d",
-                    "Number of values of N is less than 1 or greater than",
-                    HPL_MAX_PARAM );
+         HPL_pwarn( stderr, __LINE__, "HPL_pdinfo", "%s",
+                    "Number of values of N is less than 1" );
+         error = 1; goto label_error;
+      }
+/*
+ * The values of N are read one by one, as their line may be of any length
+ */
+      if( ( *N = (int *)malloc( (size_t)(*NS) * sizeof( int ) ) ) == NULL )
+      {
+         HPL_pwarn( stderr, __LINE__, "HPL_pdinfo",
+                    "Memory allocation failed" );
          error = 1; goto label_error;
       }
-
-      (void) fgets( line, HPL_LINE_MAX - 2, infp ); lineptr = line;
       for( i = 0; i < *NS; i++ )
       {
-         (void) sscanf( lineptr, "%s", num ); lineptr += strlen( num ) + 1;
-         if( ( N[ i ] = atoi( num ) ) < 0 )
+         if( fscanf( infp, "%s", num ) != 1 ) num[0] = '\0';
+         if( ( (*N)[i] = atoi( num ) ) < 0 )
          {
             HPL_pwarn( stderr, __LINE__, "HPL_pdinfo",
                        "Value of N less than 0" );
             error = 1; goto label_error;
          }
       }
+      do { if( fgets( line, HPL_LINE_MAX - 2, infp ) == NULL ) break; }
+      while( strchr( line, '\n' ) == NULL );
 /*
  * Block size (>=1) (NB)
  */
@@ -445,6 +577,7 @@ void HPL_pdinfo
          if(      j == 0 ) PF[ i ] = HPL_LEFT_LOOKING;
          else if( j == 1 ) PF[ i ] = HPL_CROUT;
          else if( j == 2 ) PF[ i ] = HPL_RIGHT_LOOKING;
+         else if( j == 3 ) PF[ i ] = HPL_RECURSIVE;
          else              PF[ i ] = HPL_RIGHT_LOOKING;
       }
 /*
@@ -603,11 +736,183 @@ void HPL_pdinfo
       (void) fgets( line, HPL_LINE_MAX - 2, infp );
       (void) sscanf( line, "%s", num ); *ALIGN = atoi( num );
       if( *ALIGN <= 0 ) *ALIGN = 4;
+/*
+ * Number of threads per process (> 0) (NTHRD)
+ */
+      *NTHRD = 1;
+      if( ( lineptr = getenv( "HPL_NUM_THREADS" ) ) != NULL )
+         *NTHRD = atoi( lineptr );
+      if( *NTHRD <= 0 ) *NTHRD = 1;
+/*
+ * Factorization engine (0=pipeline,1=task graph) (ENGINE) - optional
+ */
+      *ENGINE = HPL_ENG_PIPE;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( ( sscanf( line, "%s", num ) == 1 ) && ( atoi( num ) == 1 ) )
+            *ENGINE = HPL_ENG_DAG;
+      }
+#ifndef HPL_USE_PTHREADS
+      *ENGINE = HPL_ENG_PIPE;
+#endif
+/*
+ * BLAS backend (builtin or shared library path) (BLAS) - optional
+ */
+      (void) strcpy( BLAS, "builtin" );
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) (void) strcpy( BLAS, num );
+      }
+      if( ( ( lineptr = getenv( "HPL_BLAS" ) ) != NULL ) &&
+          ( *lineptr != '\0' ) )
+      {
+         (void) strncpy( BLAS, lineptr, HPL_LINE_MAX - 1 );
+         BLAS[HPL_LINE_MAX-1] = '\0';
+      }
+/*
+ * Checkpoint interval in panels (>= 0) (CKPT) - optional
+ */
+      *CKPT = 0;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *CKPT = atoi( num );
+         if( *CKPT < 0 ) *CKPT = 0;
+      }
+/*
+ * Checkpoint file prefix (CKPTF) - optional
+ */
+      (void) strcpy( CKPTF, "hpl.ckpt" );
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) (void) strcpy( CKPTF, num );
+      }
+/*
+ * Out-of-core memory window in MB (>= 0) (OOC) - optional
+ */
+      *OOC = 0;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *OOC = atoi( num );
+         if( *OOC < 0 ) *OOC = 0;
+      }
+/*
+ * Out-of-core file prefix (OOCF) - optional
+ */
+      (void) strcpy( OOCF, "hpl.ooc" );
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) (void) strcpy( OOCF, num );
+      }
+/*
+ * Panel broadcast precision (0=double,1=single) (BPREC) - optional
+ */
+      *BPREC = 0;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *BPREC = atoi( num );
+         if( *BPREC != 1 ) *BPREC = 0;
+      }
+/*
+ * The refinement of the solution needs the records of all the panels,
+ * that a run resumed from a checkpoint would not have
+ */
+      if( ( *BPREC == 1 ) && ( *CKPT > 0 ) )
+      {
+         HPL_pwarn( stderr, __LINE__, "HPL_pdinfo", "%s",
+                    "Checkpoints need L in double precision (BPREC 0)" );
+         error = 1; goto label_error;
+      }
+/*
+ * Number of right-hand sides solved with the factors (>= 0) (NRHS) -
+ * optional
+ */
+      *NRHS = 0;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *NRHS = atoi( num );
+         if( *NRHS < 0 ) *NRHS = 0;
+      }
+/*
+ * Collectives backend (0=HPL trees,1=MPI) (COLL) - optional
+ */
+      *COLL = HPL_COLL_TREE;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( ( sscanf( line, "%s", num ) == 1 ) && ( atoi( num ) == 1 ) )
+            *COLL = HPL_COLL_MPI;
+      }
+/*
+ * Scaling sweep (0=off,1=strong,2=weak) (SWEEP) - optional.  The grids
+ * become the most square P x Q, P <= Q, of 1, 2, 4, ... processes and
+ * of all of them.
+ */
+      *SWEEP = 0;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *SWEEP = atoi( num );
+         if( ( *SWEEP != 1 ) && ( *SWEEP != 2 ) ) *SWEEP = 0;
+      }
+/*
+ * Number of concurrent instances (>= 1) (NGRP) - optional
+ */
+      *NGRP = 1;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *NGRP = atoi( num );
+         if( ( *NGRP < 1 ) || ( *NGRP > size ) ) *NGRP = 1;
+      }
+      if( *SWEEP != 0 )
+      {
+         *NPQS = 0; nprocs = 1;
+         do
+         {
+            for( j = 1; j * j <= nprocs; j++ )
+            { if( nprocs % j == 0 ) P[*NPQS] = j; }
+            Q[*NPQS] = nprocs / P[*NPQS]; (*NPQS)++;
+            nprocs   = ( nprocs < size / *NGRP ?
+                         Mmin( 2 * nprocs, size / *NGRP ) : 0 );
+         } while( ( nprocs > 0 ) && ( *NPQS < HPL_MAX_PARAM ) );
+      }
+/*
+ * Every instance must have enough processes for the grids
+ */
+      maxp = 0;
+      for( i = 0; i < *NPQS; i++ ) maxp = Mmax( maxp, P[i] * Q[i] );
+      if( maxp * (*NGRP) > size )
+      {
+         HPL_pwarn( stderr, __LINE__, "HPL_pdinfo",
+                    "Need at least %d processes for %d instances",
+                    maxp * (*NGRP), *NGRP );
+         error = 1; goto label_error;
+      }
+/*
+ * Column weights (0=uniform) (NCW), and weights (>=0) (CW), a first one
+ * of 0 for the DGEMM calibration - optional
+ */
+      *NCW = 0;
+      if( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL )
+      {
+         if( sscanf( line, "%s", num ) == 1 ) *NCW = atoi( num );
+         if( ( *NCW < 0 ) || ( *NCW > HPL_MAX_PARAM ) ) *NCW = 0;
+      }
+      if( ( *NCW > 0 ) &&
+          ( fgets( line, HPL_LINE_MAX - 2, infp ) != NULL ) )
+      {
+         lineptr = line;
+         for( i = 0; i < *NCW; i++ )
+         {
+            if( sscanf( lineptr, "%s", num ) != 1 ) break;
+            lineptr = strstr( lineptr, num ) + strlen( num );
+            if( ( CW[i] = atoi( num ) ) < 0 ) break;
+         }
+         *NCW = i;
+      }
+      else { *NCW = 0; }
 /*
  * Close input file
  */
 label_error:
-      (void) fclose( infp );
+      if( infp != NULL ) (void) fclose( infp );
    }
    else { TEST->outfp = NULL; }
 /*
@@ -638,7 +943,7 @@ label_error:
 /*
  * Broadcast array sizes
  */
-   iwork = (int *)malloc( (size_t)(15) * sizeof( int ) );
+   iwork = (int *)malloc( (size_t)(28) * sizeof( int ) );
    if( rank == 0 )
    {
       iwork[ 0] = *NS;      iwork[ 1] = *NBS;
@@ -647,8 +952,15 @@ label_error:
       iwork[ 6] = *NDVS;    iwork[ 7] = *NRFS;     iwork[ 8] = *NTPS;
       iwork[ 9] = *NDHS;    iwork[10] = *TSWAP;    iwork[11] = *L1NOTRAN;
       iwork[12] = *UNOTRAN; iwork[13] = *EQUIL;    iwork[14] = *ALIGN;
+      iwork[15] = *NTHRD;   iwork[16] = ( *ENGINE == HPL_ENG_DAG ? 1 : 0 );
+      iwork[17] = (int)strlen( BLAS );
+      iwork[18] = *CKPT;    iwork[19] = (int)strlen( CKPTF );
+      iwork[20] = *OOC;     iwork[21] = (int)strlen( OOCF );
+      iwork[22] = *BPREC;   iwork[23] = *NRHS;
+      iwork[24] = ( *COLL == HPL_COLL_MPI ? 1 : 0 );
+      iwork[25] = *SWEEP;   iwork[26] = *NGRP;     iwork[27] = *NCW;
    }
-   (void) HPL_broadcast( (void *)iwork, 15, HPL_INT, 0, MPI_COMM_WORLD );
+   (void) HPL_broadcast( (void *)iwork, 28, HPL_INT, 0, MPI_COMM_WORLD );
    if( rank != 0 )
    {
       *NS       = iwork[ 0]; *NBS   = iwork[ 1];
@@ -657,18 +969,32 @@ label_error:
       *NDVS     = iwork[ 6]; *NRFS  = iwork[ 7]; *NTPS     = iwork[ 8];
       *NDHS     = iwork[ 9]; *TSWAP = iwork[10]; *L1NOTRAN = iwork[11];
       *UNOTRAN  = iwork[12]; *EQUIL = iwork[13]; *ALIGN    = iwork[14];
+      *NTHRD    = iwork[15];
+      *ENGINE   = ( iwork[16] == 1 ? HPL_ENG_DAG : HPL_ENG_PIPE );
+      *CKPT     = iwork[18]; *OOC   = iwork[20]; *BPREC    = iwork[22];
+      *NRHS     = iwork[23];
+      *COLL     = ( iwork[24] == 1 ? HPL_COLL_MPI : HPL_COLL_TREE );
+      *SWEEP    = iwork[25]; *NGRP  = iwork[26]; *NCW      = iwork[27];
    }
+   nblas = iwork[17]; nckpt = iwork[19]; nooc = iwork[21];
    if( iwork ) free( iwork );
+   if( rank != 0 )
+   {
+      *N = (int *)malloc( (size_t)(*NS) * sizeof( int ) );
+      if( *N == NULL )
+      { HPL_pabort( __LINE__, "HPL_pdinfo", "Memory allocation failed" ); }
+   }
 /*
  * Pack information arrays and broadcast
  */
    lwork = (*NS) + (*NBS) + 2 * (*NPQS) + (*NPFS) + (*NBMS) + 
-           (*NDVS) + (*NRFS) + (*NTPS) + (*NDHS) + 1;
+           (*NDVS) + (*NRFS) + (*NTPS) + (*NDHS) + 1 + nblas + nckpt +
+           nooc + (*NCW);
    iwork = (int *)malloc( (size_t)(lwork) * sizeof( int ) );
    if( rank == 0 )
    {
       j = 0;
-      for( i = 0; i < *NS;   i++ ) { iwork[j] = N [i]; j++; }
+      for( i = 0; i < *NS;   i++ ) { iwork[j] = (*N)[i]; j++; }
       for( i = 0; i < *NBS;  i++ ) { iwork[j] = NB[i]; j++; }
       for( i = 0; i < *NPQS; i++ ) { iwork[j] = P [i]; j++; }
       for( i = 0; i < *NPQS; i++ ) { iwork[j] = Q [i]; j++; }
@@ -677,6 +1003,7 @@ label_error:
          if(      PF[i] == HPL_LEFT_LOOKING  ) iwork[j] = 0;
          else if( PF[i] == HPL_CROUT         ) iwork[j] = 1;
          else if( PF[i] == HPL_RIGHT_LOOKING ) iwork[j] = 2;
+         else if( PF[i] == HPL_RECURSIVE     ) iwork[j] = 3;
          j++;
       }
       for( i = 0; i < *NBMS; i++ ) { iwork[j] = NBM[i]; j++; }
@@ -704,13 +1031,18 @@ label_error:
       else if( *FSWAP == HPL_SWAP01 ) iwork[j] = 1;
       else if( *FSWAP == HPL_SW_MIX ) iwork[j] = 2;
       j++;
+
+      for( i = 0; i < nblas; i++ ) { iwork[j] = (int)BLAS[i]; j++; }
+      for( i = 0; i < nckpt; i++ ) { iwork[j] = (int)CKPTF[i]; j++; }
+      for( i = 0; i < nooc;  i++ ) { iwork[j] = (int)OOCF[i];  j++; }
+      for( i = 0; i < *NCW;  i++ ) { iwork[j] = CW[i];         j++; }
    }
    (void) HPL_broadcast( (void*)iwork, lwork, HPL_INT, 0,
                          MPI_COMM_WORLD );
    if( rank != 0 )
    {
       j = 0;
-      for( i = 0; i < *NS;   i++ ) { N [i] = iwork[j]; j++; }
+      for( i = 0; i < *NS;   i++ ) { (*N)[i] = iwork[j]; j++; }
       for( i = 0; i < *NBS;  i++ ) { NB[i] = iwork[j]; j++; }
       for( i = 0; i < *NPQS; i++ ) { P [i] = iwork[j]; j++; }
       for( i = 0; i < *NPQS; i++ ) { Q [i] = iwork[j]; j++; }
@@ -720,6 +1052,7 @@ label_error:
          if(      iwork[j] == 0 ) PF[i] = HPL_LEFT_LOOKING;
          else if( iwork[j] == 1 ) PF[i] = HPL_CROUT;
          else if( iwork[j] == 2 ) PF[i] = HPL_RIGHT_LOOKING;
+         else if( iwork[j] == 3 ) PF[i] = HPL_RECURSIVE;
          j++;
       }
       for( i = 0; i < *NBMS; i++ ) { NBM[i] = iwork[j]; j++; }
@@ -747,6 +1080,14 @@ label_error:
       else if( iwork[j] == 1 ) *FSWAP = HPL_SWAP01;
       else if( iwork[j] == 2 ) *FSWAP = HPL_SW_MIX;
       j++;
+
+      for( i = 0; i < nblas; i++ ) { BLAS[i] = (char)iwork[j]; j++; }
+      BLAS[nblas] = '\0';
+      for( i = 0; i < nckpt; i++ ) { CKPTF[i] = (char)iwork[j]; j++; }
+      CKPTF[nckpt] = '\0';
+      for( i = 0; i < nooc;  i++ ) { OOCF[i]  = (char)iwork[j]; j++; }
+      OOCF[nooc] = '\0';
+      for( i = 0; i < *NCW;  i++ ) { CW[i]    = iwork[j];      j++; }
    }
    if( iwork ) free( iwork );
 /*
@@ -795,19 +1136,11 @@ label_error:
  * Problem size
  */
       HPL_fprintf( TEST->outfp,       "\nN      :" );
-      for( i = 0; i < Mmin( 8, *NS ); i++ )
-         HPL_fprintf( TEST->outfp,       "%8d ", N[i]  );
-      if( *NS > 8 )
+      for( i = 0; i < *NS; i++ )
       {
-         HPL_fprintf( TEST->outfp,    "\n        " );
-         for( i = 8; i < Mmin( 16, *NS ); i++ )
-            HPL_fprintf( TEST->outfp,    "%8d ", N[i]  );
-         if( *NS > 16 )
-         {
-            HPL_fprintf( TEST->outfp, "\n        " );
-            for( i = 16; i < *NS; i++ )
-               HPL_fprintf( TEST->outfp, "%8d ", N[i]  );
-         }
+         if( ( i > 0 ) && ( i % 8 == 0 ) )
+            HPL_fprintf( TEST->outfp,    "\n        " );
+         HPL_fprintf( TEST->outfp,       "%8d ", (*N)[i] );
       }
 /*
  * Distribution blocking factor
@@ -880,6 +1213,8 @@ label_error:
             HPL_fprintf( TEST->outfp,       "   Crout " );
          else if( PF[i] == HPL_RIGHT_LOOKING )
             HPL_fprintf( TEST->outfp,       "   Right " );
+         else if( PF[i] == HPL_RECURSIVE     )
+            HPL_fprintf( TEST->outfp,       "  Binary " );
       }
       if( *NPFS > 8 )
       {
@@ -892,6 +1227,8 @@ label_error:
                HPL_fprintf( TEST->outfp,       "   Crout " );
             else if( PF[i] == HPL_RIGHT_LOOKING )
                HPL_fprintf( TEST->outfp,       "   Right " );
+            else if( PF[i] == HPL_RECURSIVE     )
+               HPL_fprintf( TEST->outfp,       "  Binary " );
          }
          if( *NPFS > 16 )
          {
@@ -904,6 +1241,8 @@ label_error:
                   HPL_fprintf( TEST->outfp,       "   Crout " );
                else if( PF[i] == HPL_RIGHT_LOOKING )
                   HPL_fprintf( TEST->outfp,       "   Right " );
+               else if( PF[i] == HPL_RECURSIVE     )
+                  HPL_fprintf( TEST->outfp,       "  Binary " );
             }
          }
       }
@@ -1096,6 +1435,99 @@ label_error:
  */
       HPL_fprintf( TEST->outfp,       "\nALIGN  : %d double precision words",
                    *ALIGN );
+/*
+ * Threads
+ */
+      HPL_fprintf( TEST->outfp,       "\nNTHRD  : %d thread(s) per process",
+                   *NTHRD );
+/*
+ * Factorization engine
+ */
+      HPL_fprintf( TEST->outfp,       "\nENGINE :" );
+      if( *ENGINE == HPL_ENG_DAG )
+         HPL_fprintf( TEST->outfp, " task graph" );
+      else
+         HPL_fprintf( TEST->outfp, " look-ahead pipeline" );
+#ifdef HPL_CALL_DLBLAS
+/*
+ * BLAS backend
+ */
+      HPL_fprintf( TEST->outfp,       "\nBLAS   : %s", BLAS );
+#endif
+/*
+ * Checkpoints
+ */
+      if( *CKPT > 0 )
+         HPL_fprintf( TEST->outfp,
+                      "\nCKPT   : every %d panel(s) to %s.<rank>.<slot>",
+                      *CKPT, CKPTF );
+      else
+         HPL_fprintf( TEST->outfp,       "\nCKPT   : off" );
+/*
+ * Out-of-core factorization
+ */
+      if( *OOC > 0 )
+         HPL_fprintf( TEST->outfp,
+                      "\nOOC    : %d MB per process, backed by %s.<rank>",
+                      *OOC, OOCF );
+      else
+         HPL_fprintf( TEST->outfp,       "\nOOC    : off" );
+/*
+ * Panel broadcast precision
+ */
+      if( *BPREC == 1 )
+         HPL_fprintf( TEST->outfp,
+                      "\nBPREC  : L in single precision, refined solution" );
+      else
+         HPL_fprintf( TEST->outfp,       "\nBPREC  : L in double precision" );
+/*
+ * Right-hand sides solved with the factors
+ */
+      if( *NRHS > 0 )
+         HPL_fprintf( TEST->outfp,
+                      "\nNRHS   : %d solved with the factors of every test",
+                      *NRHS );
+      else
+         HPL_fprintf( TEST->outfp,       "\nNRHS   : off" );
+/*
+ * Collectives backend
+ */
+      if( *COLL == HPL_COLL_MPI )
+         HPL_fprintf( TEST->outfp,       "\nCOLL   : MPI collectives" );
+      else
+         HPL_fprintf( TEST->outfp,       "\nCOLL   : HPL binomial trees" );
+/*
+ * Scaling sweep
+ */
+      if(      *SWEEP == 1 )
+         HPL_fprintf( TEST->outfp,       "\nSWEEP  : strong scaling, N fixed" );
+      else if( *SWEEP == 2 )
+         HPL_fprintf( TEST->outfp,
+                      "\nSWEEP  : weak scaling, N times sqrt(P*Q)" );
+      else
+         HPL_fprintf( TEST->outfp,       "\nSWEEP  : off" );
+/*
+ * Concurrent instances
+ */
+      if( *NGRP > 1 )
+         HPL_fprintf( TEST->outfp,
+                      "\nNGRP   : %d concurrent instances of %d processes",
+                      *NGRP, size / *NGRP );
+      else
+         HPL_fprintf( TEST->outfp,       "\nNGRP   : 1 instance" );
+/*
+ * Column weights
+ */
+      if( *NCW == 0 )
+         HPL_fprintf( TEST->outfp,       "\nWEIGHTS: uniform, block-cyclic" );
+      else if( CW[0] == 0 )
+         HPL_fprintf( TEST->outfp,       "\nWEIGHTS: DGEMM calibration" );
+      else
+      {
+         HPL_fprintf( TEST->outfp,       "\nWEIGHTS:" );
+         for( i = 0; i < *NCW; i++ )
+            HPL_fprintf( TEST->outfp, " %d", CW[i] );
+      }
 
       HPL_fprintf( TEST->outfp, "\n\n" );
 /*
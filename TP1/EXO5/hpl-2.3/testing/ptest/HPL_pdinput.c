@@ -0,0 +1,397 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+#include <ctype.h>
+/*
+ * Number of lines of HPL.dat,  and keys of the key=value input with the
+ * line of their number of values (-1 for a single value) and the line
+ * of their value(s)
+ */
+#define    HPL_INPUT_NLINE       44
+#define    HPL_INPUT_NKEY        31
+
+static const char * HPL_input_key[HPL_INPUT_NKEY] =
+{
+   "OUT",      "N",        "NB",       "PMAP",     "P",        "Q",
+   "THRESHOLD","PFACT",    "NBMIN",    "NDIV",     "RFACT",    "BCAST",
+   "DEPTH",    "SWAP",     "SWAPTHR",  "L1",       "U",        "EQUIL",
+   "ALIGN",    "ENGINE",   "BLAS",     "CKPT",     "CKPTFILE", "OOC",
+   "OOCFILE",  "BPREC",    "NRHS",     "COLL",     "SWEEP",    "NGRP",
+   "WEIGHTS"
+};
+static const int    HPL_input_cnt[HPL_INPUT_NKEY] =
+{
+   -1,  4,  6, -1,  9,  9, -1, 13, 15, 17, 19, 21, 23, -1, -1, -1, -1, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 42
+};
+static const int    HPL_input_val[HPL_INPUT_NKEY] =
+{
+    2,  5,  7,  8, 10, 11, 12, 14, 16, 18, 20, 22, 24, 25, 26, 27, 28, 29,
+   30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 43
+};
+/*
+ * Lines used when the input is not an HPL.dat file
+ */
+static const char * HPL_input_dflt[HPL_INPUT_NLINE] =
+{
+   "HPLinpack benchmark input file",
+   "Innovative Computing Laboratory, University of Tennessee",
+   "HPL.out", "6", "1", "1000", "1", "128", "0", "1", "1", "1", "16.0",
+   "1", "2", "1", "4", "1", "2", "1", "1", "1", "1", "1", "1", "2", "64",
+   "0", "0", "1", "8", "0", "builtin", "0", "hpl.ckpt", "0", "hpl.ooc",
+   "0", "0", "0", "0", "1", "0", "0"
+};
+
+#ifdef STDC_HEADERS
+static char * HPL_pdinput_gets
+(
+   FILE *                           STREAM
+)
+#else
+static char * HPL_pdinput_gets( STREAM )
+   FILE *                           STREAM;
+#endif
+{
+/*
+ * Return the next line of STREAM  without its end of line,  whatever its
+ * length, in an array allocated with malloc, or NULL at the end of the
+ * stream.
+ */
+   char                       * buf, * tmp;
+   int                        c, len = 0, size = HPL_LINE_MAX;
+
+   if( ( buf = (char *)malloc( (size_t)(size) ) ) == NULL ) return( NULL );
+   while( ( ( c = fgetc( STREAM ) ) != EOF ) && ( c != '\n' ) )
+   {
+      if( len + 1 >= size )
+      {
+         size *= 2; tmp = (char *)realloc( buf, (size_t)(size) );
+         if( tmp == NULL ) { free( buf ); return( NULL ); }
+         buf = tmp;
+      }
+      buf[len++] = (char)(c);
+   }
+   if( ( c == EOF ) && ( len == 0 ) ) { free( buf ); return( NULL ); }
+   buf[len] = '\0';
+   return( buf );
+}
+
+#ifdef STDC_HEADERS
+static int HPL_pdinput_set
+(
+   char * *                         LINES,
+   int *                            NVAL,
+   const char *                     KEYVAL
+)
+#else
+static int HPL_pdinput_set( LINES, NVAL, KEYVAL )
+   char * *                         LINES;
+   int *                            NVAL;
+   const char *                     KEYVAL;
+#endif
+{
+/*
+ * Apply  KEYVAL,  of the form KEY=VALUE,  to the lines of HPL.dat. The
+ * key is not case sensitive. A list of values is separated by commas
+ * or blanks, and a:b or a:b:s stands for a, a+s, ... up to b (s=1 by
+ * default).  The number of values is kept in the entry of NVAL of the
+ * key.  Return 0,  or 1 and print a message for an illegal input.
+ */
+   char                       key[HPL_LINE_MAX], tok[HPL_LINE_MAX];
+   char                       * val, * buf;
+   const char                 * p;
+   size_t                     len, size;
+   int                        a, b, ik, k, n = 0, s;
+
+   if( ( p = strchr( KEYVAL, '=' ) ) == NULL )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput", "Illegal input %s",
+                 KEYVAL );
+      return( 1 );
+   }
+   len = (size_t)( p - KEYVAL );
+   while( ( len > 0 ) && isspace( (int)(KEYVAL[len-1]) ) ) len--;
+   for( k = 0; isspace( (int)(KEYVAL[k]) ); k++ );
+   if( ( len <= (size_t)(k) ) || ( len - k >= HPL_LINE_MAX ) )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput", "Illegal input %s",
+                 KEYVAL );
+      return( 1 );
+   }
+   for( ik = 0; (size_t)(k) < len; k++ )
+      key[ik++] = (char)toupper( (int)(KEYVAL[k]) );
+   key[ik] = '\0';
+
+   for( ik = 0; ik < HPL_INPUT_NKEY; ik++ )
+   { if( strcmp( key, HPL_input_key[ik] ) == 0 ) break; }
+   if( ik == HPL_INPUT_NKEY )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput", "Unknown key %s", key );
+      return( 1 );
+   }
+/*
+ * Expand the list of values, separated by single blanks
+ */
+   size = strlen( p ) + 2;
+   if( ( buf = (char *)malloc( size ) ) == NULL ) return( 1 );
+   buf[0] = '\0'; len = 0; p++;
+
+   while( *p != '\0' )
+   {
+      while( ( *p == ',' ) || isspace( (int)(*p) ) ) p++;
+      if( *p == '\0' ) break;
+      for( k = 0; ( p[k] != '\0' ) && ( p[k] != ',' ) &&
+                  !isspace( (int)(p[k]) ) && ( k < HPL_LINE_MAX - 1 ); k++ )
+         tok[k] = p[k];
+      tok[k] = '\0'; p += k;
+
+      s = 1;
+      if( ( HPL_input_cnt[ik] >= 0 ) && ( strchr( tok, ':' ) != NULL ) &&
+          ( sscanf( tok, "%d:%d:%d", &a, &b, &s ) >= 2 ) && ( s > 0 ) )
+      {
+         for( ; a <= b; a += s )
+         {
+            if( len + 24 > size )
+            {
+               size *= 2; val = (char *)realloc( buf, size );
+               if( val == NULL ) { free( buf ); return( 1 ); }
+               buf = val;
+            }
+            len += (size_t)sprintf( buf + len, "%s%d", ( n ? " " : "" ),
+                                    a );
+            n++;
+         }
+      }
+      else
+      {
+         if( len + strlen( tok ) + 2 > size )
+         {
+            size = 2 * size + strlen( tok ); val = (char *)realloc( buf,
+                                                                  size );
+            if( val == NULL ) { free( buf ); return( 1 ); }
+            buf = val;
+         }
+         len += (size_t)sprintf( buf + len, "%s%s", ( n ? " " : "" ), tok );
+         n++;
+      }
+      if( HPL_input_cnt[ik] < 0 ) break;
+   }
+   if( n == 0 )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput", "No value for key %s",
+                 key );
+      free( buf ); return( 1 );
+   }
+/*
+ * OUT selects the device with the file name:  stdout, stderr or a file
+ */
+   k = HPL_input_val[ik]; NVAL[ik] = n;
+   free( LINES[k] ); LINES[k] = buf;
+   if( ik == 0 )
+   {
+      free( LINES[3] ); LINES[3] = (char *)malloc( 2 );
+      if( LINES[3] == NULL ) return( 1 );
+      if(      strcmp( buf, "stdout" ) == 0 ) (void) strcpy( LINES[3], "6" );
+      else if( strcmp( buf, "stderr" ) == 0 ) (void) strcpy( LINES[3], "7" );
+      else                                    (void) strcpy( LINES[3], "8" );
+   }
+   else if( HPL_input_cnt[ik] >= 0 )
+   {
+      k = HPL_input_cnt[ik];
+      free( LINES[k] ); LINES[k] = (char *)malloc( 16 );
+      if( LINES[k] == NULL ) return( 1 );
+      (void) sprintf( LINES[k], "%d", n );
+   }
+   return( 0 );
+}
+
+#ifdef STDC_HEADERS
+FILE * HPL_pdinput
+(
+   const int                        ARGC,
+   char * *                         ARGV
+)
+#else
+FILE * HPL_pdinput( ARGC, ARGV )
+   const int                        ARGC;
+   char * *                         ARGV;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdinput opens the input of HPL_pdinfo.  The input file is the first
+ * command line argument that is not of the form  KEY=VALUE,  or HPL.dat.
+ * It is either an HPL.dat file, or a list of KEY = VALUE lines, where
+ * the lines starting with # are ignored  and  the parameters not given
+ * take default values.  The KEY=VALUE arguments of the command line are
+ * then applied in turn,  for instance
+ *
+ *    mpirun -np 4 xhpl N=1000:20000:1000 NB=192 P=2 Q=2
+ *
+ * The keys are OUT (a file name,  stdout or stderr),  N, NB, PMAP, P,
+ * Q, THRESHOLD, PFACT, NBMIN, NDIV, RFACT, BCAST, DEPTH, SWAP, SWAPTHR
+ * (the swapping threshold),  L1,  U, EQUIL, ALIGN, ENGINE, BLAS, CKPT,
+ * CKPTFILE, OOC, OOCFILE, BPREC, NRHS, COLL, SWEEP, NGRP and WEIGHTS,
+ * that take the values of the corresponding lines of HPL.dat. The keys of lists
+ * take any number of values separated by commas or blanks,  where a:b
+ * and a:b:s are ranges of integers.  P and Q must be given together.
+ *
+ * Unless the input file is an HPL.dat file and the command line has no
+ * KEY=VALUE argument, the resulting HPL.dat is written in a temporary
+ * file, which is returned.  This function is called by process 0 only.
+ *
+ * Arguments
+ * =========
+ *
+ * ARGC    (local input)                 const int
+ *         On entry, ARGC specifies the number of arguments in ARGV.
+ *
+ * ARGV    (local input)                 char * *
+ *         On entry,  ARGV  is an array of dimension ARGC containing the
+ *         command line arguments, the first one being the program name.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   char                       * lines[HPL_INPUT_NLINE];
+   int                        nval[HPL_INPUT_NKEY];
+   const char                 * file = "HPL.dat";
+   char                       * buf;
+   FILE                       * infp, * tmp;
+   int                        error = 0, i, kv, nfile = 0, nl, nover = 0;
+/* ..
+ * .. Executable Statements ..
+ */
+   for( i = 1; i < ARGC; i++ )
+   {
+      if( strchr( ARGV[i], '=' ) != NULL ) nover++;
+      else if( nfile++ == 0 ) file = ARGV[i];
+   }
+   if( ( infp = fopen( file, "r" ) ) == NULL )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput", "cannot open file %s",
+                 file );
+      return( NULL );
+   }
+/*
+ * The input is a list of KEY = VALUE  lines when its first line that is
+ * neither blank nor a comment has an equal sign.
+ */
+   kv = 0;
+   while( ( buf = HPL_pdinput_gets( infp ) ) != NULL )
+   {
+      for( i = 0; isspace( (int)(buf[i]) ); i++ );
+      if( ( buf[i] != '\0' ) && ( buf[i] != '#' ) )
+      { kv = ( strchr( buf, '=' ) != NULL ); free( buf ); break; }
+      free( buf );
+   }
+   rewind( infp );
+   if( !kv && ( nover == 0 ) ) return( infp );
+/*
+ * Lines of the HPL.dat file, completed by the defaults of the optional
+ * ones, or the defaults with the KEY = VALUE lines applied.
+ */
+   for( i = 0; i < HPL_INPUT_NKEY; i++ ) nval[i] = 0;
+   for( i = 0; i < HPL_INPUT_NLINE; i++ )
+   {
+      lines[i] = (char *)malloc( strlen( HPL_input_dflt[i] ) + 1 );
+      if( lines[i] == NULL )
+      { HPL_pabort( __LINE__, "HPL_pdinput", "Memory allocation failed" ); }
+      (void) strcpy( lines[i], HPL_input_dflt[i] );
+   }
+   for( nl = 0; ( buf = HPL_pdinput_gets( infp ) ) != NULL; nl++ )
+   {
+      if( kv )
+      {
+         for( i = 0; isspace( (int)(buf[i]) ); i++ );
+         if( ( buf[i] != '\0' ) && ( buf[i] != '#' ) )
+            error |= HPL_pdinput_set( lines, nval, buf + i );
+         free( buf );
+      }
+      else if( nl < HPL_INPUT_NLINE ) { free( lines[nl] ); lines[nl] = buf; }
+      else { free( buf ); }
+   }
+   (void) fclose( infp );
+
+   for( i = 1; i < ARGC; i++ )
+   {
+      if( strchr( ARGV[i], '=' ) != NULL )
+         error |= HPL_pdinput_set( lines, nval, ARGV[i] );
+   }
+   if( ( nval[4] != nval[5] ) && !error )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput", "%s",
+                 "P and Q must be given together with as many values" );
+      error = 1;
+   }
+/*
+ * Write the resulting HPL.dat
+ */
+   tmp = NULL;
+   if( !error && ( ( tmp = tmpfile() ) == NULL ) )
+   {
+      HPL_pwarn( stderr, __LINE__, "HPL_pdinput",
+                 "cannot create a temporary file" );
+   }
+   for( i = 0; i < HPL_INPUT_NLINE; i++ )
+   {
+      if( tmp != NULL ) (void) fprintf( tmp, "%s\n", lines[i] );
+      free( lines[i] );
+   }
+   if( tmp != NULL ) rewind( tmp );
+   return( tmp );
+/*
+ * End of HPL_pdinput
+ */
+}
@@ -0,0 +1,251 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef HPL_USE_PTHREADS
+typedef struct HPL_S_pdregen
+{
+   pthread_mutex_t     lock;             /* protects the # of columns */
+   pthread_cond_t      wake;              /* signals every new column */
+   const HPL_T_grid    * grid;                        /* process grid */
+   double              * A;               /* local piece of [ A | b ] */
+   int                 n;                               /* order of A */
+   int                 nb;                         /* blocking factor */
+   int                 lda;                 /* leading dimension of A */
+   int                 iseed;                /* seed of the generator */
+   int                 ncol;   /* # of local columns generated so far */
+} HPL_T_pdregen;
+
+#ifdef STDC_HEADERS
+static void HPL_pdregen_post
+(
+   void *                           ARG,
+   const int                        NCOL
+)
+#else
+static void HPL_pdregen_post( ARG, NCOL )
+   void *                           ARG;
+   const int                        NCOL;
+#endif
+{
+/*
+ * Publish that the NCOL leading local columns are generated.
+ */
+   HPL_T_pdregen              * P = (HPL_T_pdregen *)(ARG);
+
+   pthread_mutex_lock( &(P->lock) );
+   P->ncol = NCOL;
+   pthread_cond_signal( &(P->wake) );
+   pthread_mutex_unlock( &(P->lock) );
+}
+
+#ifdef STDC_HEADERS
+static void HPL_pdregen_wait
+(
+   void *                           ARG,
+   const int                        NCOL
+)
+#else
+static void HPL_pdregen_wait( ARG, NCOL )
+   void *                           ARG;
+   const int                        NCOL;
+#endif
+{
+/*
+ * Wait until the NCOL leading local columns are generated.
+ */
+   HPL_T_pdregen              * P = (HPL_T_pdregen *)(ARG);
+
+   pthread_mutex_lock( &(P->lock) );
+   while( P->ncol < NCOL ) pthread_cond_wait( &(P->wake), &(P->lock) );
+   pthread_mutex_unlock( &(P->lock) );
+}
+
+#ifdef STDC_HEADERS
+static void * HPL_pdregen_gen
+(
+   void *                           ARG
+)
+#else
+static void * HPL_pdregen_gen( ARG )
+   void *                           ARG;
+#endif
+{
+/*
+ * Producer: generate [ A | b ] and publish every local block of columns.
+ */
+   HPL_T_pdregen              * P = (HPL_T_pdregen *)(ARG);
+
+   HPL_pdmatgenp( P->grid, P->n, P->n + 1, P->nb, P->A, P->lda, P->iseed,
+                  HPL_pdregen_post, ARG );
+   return( NULL );
+}
+#endif
+
+#ifdef STDC_HEADERS
+void HPL_pdregen
+(
+   const HPL_T_grid *               GRID,
+   const int                        NTHRD,
+   const int                        N,
+   const int                        NB,
+   double *                         A,
+   const int                        LDA,
+   const double *                   X,
+   const int                        ISEED,
+   double *                         NRM
+)
+#else
+void HPL_pdregen
+( GRID, NTHRD, N, NB, A, LDA, X, ISEED, NRM )
+   const HPL_T_grid *               GRID;
+   const int                        NTHRD;
+   const int                        N;
+   const int                        NB;
+   double *                         A;
+   const int                        LDA;
+   const double *                   X;
+   const int                        ISEED;
+   double *                         NRM;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdregen regenerates  the  N by N+1 matrix [ A | b ]  and computes
+ * the norms of the residual check of the solution x with HPL_pdresid.
+ * When the threads are enabled,  a producer thread generates the local
+ * columns of [ A | b ] with HPL_pdmatgenp,  while the calling thread
+ * consumes every local block of NB columns as soon as it is published,
+ * so that the single pass over [ A | b ]  is hidden behind its genera-
+ * tion.  Otherwise,  or if the thread cannot be created,  [ A | b ]  is
+ * generated first and then read by NTHRD threads.
+ *
+ * Arguments
+ * =========
+ *
+ * GRID    (local input)                 const HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * NTHRD   (local input)                 const int
+ *         On entry,  NTHRD  specifies the number of threads that may be
+ *         used by HPL_pdresid when [ A | b ] is generated first.
+ *
+ * N       (global input)                const int
+ *         On entry,  N specifies the order of the matrix A. N must be at
+ *         least zero.
+ *
+ * NB      (global input)                const int
+ *         On entry,  NB specifies the blocking factor used to partition
+ *         and distribute the matrix. NB must be larger than one.
+ *
+ * A       (local output)                double *
+ *         On entry, A points to an array of dimension LDA by the local
+ *         number of columns of [ A | b ].  On exit,  this array contains
+ *         the local pieces of the regenerated matrix [ A | b ].
+ *
+ * LDA     (local input)                 const int
+ *         On entry, LDA specifies the leading dimension of the array A.
+ *         LDA must be at least max(1,mp).
+ *
+ * X       (local input)                 const double *
+ *         On entry,  X  points to the local piece of the solution x,  of
+ *         dimension the local number of columns of A,  replicated in
+ *         every process row.
+ *
+ * ISEED   (global input)                const int
+ *         On entry, ISEED  specifies  the  seed  number  the matrix was
+ *         generated with.
+ *
+ * NRM     (global output)               double *
+ *         On exit, NRM is an array of dimension 6 that contains in every
+ *         process ||A||_1,  ||A||_oo,  ||x||_1, ||x||_oo, ||b||_oo and
+ *         ||b - A x||_oo in that order.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+#ifdef HPL_USE_PTHREADS
+   HPL_T_pdregen              P;
+   pthread_t                  thread;
+#endif
+/* ..
+ * .. Executable Statements ..
+ */
+#ifdef HPL_USE_PTHREADS
+   P.grid = GRID; P.A = A; P.n = N; P.nb = NB; P.lda = LDA;
+   P.iseed = ISEED; P.ncol = 0;
+   pthread_mutex_init( &(P.lock), NULL );
+   pthread_cond_init( &(P.wake), NULL );
+
+   if( HPL_thrd && ( N > 0 ) &&
+       ( pthread_create( &thread, NULL, HPL_pdregen_gen, (void *)(&P) ) ==
+         0 ) )
+   {
+      HPL_pdresid( GRID, NTHRD, N, NB, A, LDA, X, HPL_pdregen_wait,
+                   (void *)(&P), NRM );
+      (void) pthread_join( thread, NULL );
+      pthread_cond_destroy( &(P.wake) );
+      pthread_mutex_destroy( &(P.lock) );
+      return;
+   }
+   pthread_cond_destroy( &(P.wake) );
+   pthread_mutex_destroy( &(P.lock) );
+#endif
+   HPL_pdmatgen( GRID, N, N+1, NB, A, LDA, ISEED );
+   HPL_pdresid( GRID, NTHRD, N, NB, A, LDA, X, NULL, NULL, NRM );
+/*
+ * End of HPL_pdregen
+ */
+}
@@ -0,0 +1,177 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdsweep
+(
+   HPL_T_test *                     TEST,
+   const int                        SWEEP,
+   const int                        NPQS,
+   const int *                      P,
+   const int *                      Q,
+   const int                        NCOMB,
+   const double *                   RES
+)
+#else
+void HPL_pdsweep
+( TEST, SWEEP, NPQS, P, Q, NCOMB, RES )
+   HPL_T_test *                     TEST;
+   const int                        SWEEP;
+   const int                        NPQS;
+   const int *                      P;
+   const int *                      Q;
+   const int                        NCOMB;
+   const double *                   RES;
+#endif
+{
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_pdsweep prints the table of a strong or weak scaling sweep: for
+ * every combination of the parameters, the problem size, the time and
+ * the Gflops of every grid,  followed by the speedup and the parallel
+ * efficiency with respect to the first grid of the sweep.  The speedup
+ * is the ratio of the Gflops,  that is the ratio of the times in a
+ * strong scaling sweep (Amdahl) and the scaled speedup in a weak scal-
+ * ing sweep (Gustafson);  the efficiency is the speedup divided by the
+ * ratio of the numbers of processes.  Tests that were skipped have no
+ * time and are shown as such.
+ *
+ * Arguments
+ * =========
+ *
+ * TEST    (global input)                HPL_T_test *
+ *         On entry,  TEST  points  to the test data structure:  outfp is
+ *         the output file stream.
+ *
+ * SWEEP   (global input)                const int
+ *         On entry,  SWEEP  is  1  for a strong  and  2  for a weak scal-
+ *         ing sweep.
+ *
+ * NPQS    (global input)                const int
+ *         On entry, NPQS specifies the number of grids of the sweep.
+ *
+ * P       (global input)                const int *
+ *         On entry,  P  is an array of dimension NPQS that contains the
+ *         number of process rows of the grids.
+ *
+ * Q       (global input)                const int *
+ *         On entry,  Q  is an array of dimension NPQS that contains the
+ *         number of process columns of the grids.
+ *
+ * NCOMB   (global input)                const int
+ *         On entry, NCOMB specifies the number of combinations of the
+ *         parameters run on every grid.
+ *
+ * RES     (global input)                const double *
+ *         On entry,  RES  is an array of dimension 4*NCOMB*NPQS. Entry
+ *         4*(k*NCOMB+c) and the next three contain N, NB, the wall time
+ *         and the Gflops of combination c on grid k.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * .. Local Variables ..
+ */
+   const double               * r, * r0;
+   double                     eff, spd;
+   int                        c, k;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( NPQS <= 0 ) || ( NCOMB <= 0 ) ) return;
+
+   HPL_fprintf( TEST->outfp, "%s%s\n",
+                "========================================",
+                "========================================" );
+   HPL_fprintf( TEST->outfp, "%s\n", ( SWEEP == 1 ?
+                "Strong scaling sweep, N fixed" :
+                "Weak scaling sweep, N times sqrt(P*Q)" ) );
+   HPL_fprintf( TEST->outfp, "%s%s\n",
+                " Procs     P     Q         N    NB           Time",
+                "        Gflops  Speedup  Effic." );
+
+   for( c = 0; c < NCOMB; c++ )
+   {
+      HPL_fprintf( TEST->outfp, "%s%s\n",
+                   "----------------------------------------",
+                   "----------------------------------------" );
+      r0 = RES + 4 * c;
+      for( k = 0; k < NPQS; k++ )
+      {
+         r = RES + 4 * ( k * NCOMB + c );
+         if( r[2] <= HPL_rzero )
+         {
+            HPL_fprintf( TEST->outfp, "%6d%6d%6d%10d%6d %14s\n",
+                         P[k] * Q[k], P[k], Q[k], (int)(r[0]), (int)(r[1]),
+                         "skipped" );
+            continue;
+         }
+         spd = eff = HPL_rzero;
+         if( r0[3] > HPL_rzero )
+         {
+            spd = r[3] / r0[3];
+            eff = spd * (double)(P[0] * Q[0]) / (double)(P[k] * Q[k]);
+         }
+         HPL_fprintf( TEST->outfp,
+                      "%6d%6d%6d%10d%6d %14.4f %13.4e %8.2f %7.3f\n",
+                      P[k] * Q[k], P[k], Q[k], (int)(r[0]), (int)(r[1]),
+                      r[2], r[3], spd, eff );
+      }
+   }
+   HPL_fprintf( TEST->outfp, "%s%s\n",
+                "========================================",
+                "========================================" );
+/*
+ * End of HPL_pdsweep
+ */
+}
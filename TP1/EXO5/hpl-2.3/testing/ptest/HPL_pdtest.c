@@ -120,15 +120,20 @@ void HPL_pdtest
  * .. Local Variables ..
  */
 #ifdef HPL_DETAILED_TIMING
-   double                     HPL_w[HPL_TIMING_N];
+   static const char          * HPL_tname[HPL_TIMING_N] =
+   { "rfact", "pfact", "mxswp", "update", "laswp", "up tr sv",
+     "checkpoint" };
+   double                     HPL_w[HPL_TIMING_N], HPL_s[5*HPL_TIMING_N],
+                              HPL_c[HPL_NPTCTR][HPL_TIMING_N];
+   int                        ir, it, pc, pr;
 #endif
    HPL_T_pmat                 mat;
-   double                     wtime[1];
+   double                     wtime[1], ckst[3], oost[4], mxst[3], nrm[6];
    int                        info[3];
-   double                     Anorm1, AnormI, Gflops, Xnorm1, XnormI,
-                              BnormI, resid0, resid1;
-   double                     * Bptr;
-   void                       * vptr = NULL;
+   double                     Anorm1, AnormI, Gflops, Mres, Xnorm1,
+                              XnormI, BnormI, resid0, resid1;
+   void                       * vptr = NULL, * wptr = NULL;
+   size_t                     lvptr, lwptr = 0;
    static int                 first=1;
    int                        ii, ip2, mycol, myrow, npcol, nprow, nq;
    char                       ctop, cpfact, crfact;
@@ -137,10 +142,26 @@ void HPL_pdtest
  * .. Executable Statements ..
  */
    (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
+   TEST->wtime = TEST->gflops = HPL_rzero;
+/*
+ * The weighted column distribution of the grid is used by the pipeline
+ * with look-ahead.  It does not apply to the out-of-core,  checkpoint,
+ * task graph, single precision broadcast and right-hand sides paths.
+ */
+   GRID->ncyc = GRID->wcyc;
+   if( ( ALGO->ooc > 0 ) || ( ALGO->ckpt > 0 ) || ( ALGO->nrhs > 0 ) ||
+       ( ALGO->engine == HPL_ENG_DAG ) || ( ALGO->bprec == 1 ) )
+      GRID->ncyc = 0;
+/*
+ * Tabulate the row and column distributions once for this test
+ */
+   HPL_ixmap_init( HPL_ixmap,   N,   NB, myrow, nprow );
+   if( GRID->ncyc == 0 )
+      HPL_ixmap_init( HPL_ixmap+1, N+1, NB, mycol, npcol );
 
    mat.n  = N; mat.nb = NB; mat.info = 0;
    mat.mp = HPL_numroc( N, NB, NB, myrow, 0, nprow );
-   nq     = HPL_numroc( N, NB, NB, mycol, 0, npcol );
+   nq     = HPL_numrocW( N, 0, NB, mycol, GRID );
    mat.nq = nq + 1;
 /*
  * Allocate matrix, right-hand-side, and vector solution x. [ A | b ] is
@@ -159,12 +180,28 @@ void HPL_pdtest
    }
    while( mat.ld == ip2 );
 /*
- * Allocate dynamic memory
+ * Allocate dynamic memory, backed by a file in out-of-core mode
+ */
+   lvptr = ( (size_t)(ALGO->align) + 
+             (size_t)(mat.ld+1) * (size_t)(mat.nq) ) * sizeof(double);
+   vptr  = HPL_pdooc_alloc( GRID, ALGO, lvptr );
+/*
+ * With L broadcast in single precision, keep a copy of [ A | b ] and the
+ * record of the local panels for the refinement of the solution.  Keep
+ * the record alone to solve other right-hand sides with the factors,
+ * or to apply the panels of the previous slabs out-of-core.
  */
-   vptr = (void*)malloc( ( (size_t)(ALGO->align) + 
-                           (size_t)(mat.ld+1) * (size_t)(mat.nq) ) *
-                         sizeof(double) );
-   info[0] = (vptr == NULL); info[1] = myrow; info[2] = mycol;
+   if( ( ( ALGO->bprec == 1 ) && ( npcol > 1 ) ) || ( ALGO->nrhs > 0 ) ||
+       ( ALGO->ooc > 0 ) )
+   {
+      lwptr = (size_t)(nq / NB + 1) * (size_t)(NB * NB + NB + 1);
+      if( ( ALGO->bprec == 1 ) && ( npcol > 1 ) )
+         lwptr += (size_t)(mat.ld) * (size_t)(mat.nq);
+      lwptr *= sizeof(double);
+      wptr   = HPL_pdooc_alloc( GRID, ALGO, lwptr );
+   }
+   info[0] = ( ( vptr == NULL ) || ( ( lwptr > 0 ) && ( wptr == NULL ) ) );
+   info[1] = myrow; info[2] = mycol;
    (void) HPL_all_reduce( (void *)(info), 3, HPL_INT, HPL_max,
                           GRID->all_comm );
    if( info[0] != 0 )
@@ -175,7 +212,9 @@ void HPL_pdtest
                     "Memory allocation failed for A, x and b. Skip." );
       (TEST->kskip)++;
       /* some processes might have succeeded with allocation */
-      if (vptr) free(vptr);
+      HPL_pdooc_free( ALGO, vptr, lvptr );
+      HPL_pdooc_free( ALGO, wptr, lwptr );
+      HPL_ixmap_free( HPL_ixmap ); HPL_ixmap_free( HPL_ixmap+1 );
       return;
    }
 /*
@@ -185,6 +224,14 @@ void HPL_pdtest
                                ((size_t)(ALGO->align) * sizeof(double) ) );
    mat.X  = Mptr( mat.A, 0, mat.nq, mat.ld );
    HPL_pdmatgen( GRID, N, N+1, NB, mat.A, mat.ld, HPL_ISEED );
+   mat.A0 = NULL; mat.R = (double *)(wptr);
+   if( ( wptr != NULL ) && ( ALGO->bprec == 1 ) && ( npcol > 1 ) )
+   {
+      mat.A0 = (double *)(wptr);
+      mat.R  = mat.A0 + (size_t)(mat.ld) * (size_t)(mat.nq);
+      (void) memcpy( (void *)(mat.A0), (const void *)(mat.A),
+                     (size_t)(mat.ld) * (size_t)(mat.nq) * sizeof(double) );
+   }
 #ifdef HPL_CALL_VSIPL
    mat.block = vsip_blockbind_d( (vsip_scalar_d *)(mat.A),
                                  (vsip_length)(mat.ld * mat.nq),
@@ -193,6 +240,9 @@ void HPL_pdtest
 /*
  * Solve linear system
  */
+#ifdef HPL_BLAS_STATS
+   HPL_blas_reset();
+#endif
    HPL_ptimer_boot(); (void) HPL_barrier( GRID->all_comm );
    time( &current_time_start );
    HPL_ptimer( 0 );
@@ -226,16 +276,32 @@ void HPL_pdtest
       }
 /*
  * 2/3 N^3 - 1/2 N^2 flops for LU factorization + 2 N^2 flops for solve.
+ * A run resumed from the checkpoint at column jrst only factors the
+ * trailing M = N - jrst columns, i.e. 2/3 M^3 - 1/2 M^2 flops.
  * Print WALL time
  */
-      Gflops = ( ( (double)(N) /   1.0e+9 ) * 
-                 ( (double)(N) / wtime[0] ) ) * 
-                 ( ( 2.0 / 3.0 ) * (double)(N) + ( 3.0 / 2.0 ) );
+      if( HPL_ckst.jrst > 0 )
+      {
+         Mres   = (double)(N - HPL_ckst.jrst);
+         Gflops = ( ( Mres / 1.0e+9 ) * ( Mres / wtime[0] ) ) *
+                  ( ( 2.0 / 3.0 ) * Mres - 0.5 ) +
+                  2.0 * ( (double)(N) / 1.0e+9 ) * ( (double)(N) / wtime[0] );
+      }
+      else
+      {
+         Gflops = ( ( (double)(N) /   1.0e+9 ) * 
+                    ( (double)(N) / wtime[0] ) ) * 
+                    ( ( 2.0 / 3.0 ) * (double)(N) + ( 3.0 / 2.0 ) );
+      }
+      TEST->wtime = wtime[0]; TEST->gflops = Gflops;
 
       cpfact = ( ( (HPL_T_FACT)(ALGO->pfact) == 
                    (HPL_T_FACT)(HPL_LEFT_LOOKING) ) ?  (char)('L') :
                  ( ( (HPL_T_FACT)(ALGO->pfact) == (HPL_T_FACT)(HPL_CROUT) ) ?
-                   (char)('C') : (char)('R') ) );
+                   (char)('C') :
+                 ( ( (HPL_T_FACT)(ALGO->pfact) ==
+                     (HPL_T_FACT)(HPL_RECURSIVE) ) ?
+                   (char)('B') : (char)('R') ) ) );
       crfact = ( ( (HPL_T_FACT)(ALGO->rfact) == 
                    (HPL_T_FACT)(HPL_LEFT_LOOKING) ) ?  (char)('L') :
                  ( ( (HPL_T_FACT)(ALGO->rfact) == (HPL_T_FACT)(HPL_CROUT) ) ? 
@@ -260,9 +326,100 @@ void HPL_pdtest
              "HPL_pdgesv() end time   %s\n", ctime( &current_time_end ) );
       }
    }
+#ifdef HPL_BLAS_STATS
+/*
+ * Combine and print the BLAS call statistics of the solve
+ */
+   HPL_pdblstat( TEST, GRID );
+#endif
+/*
+ * Combine and print the checkpoint statistics of the solve: the total
+ * volume written, the time the factorization spent taking snapshots and
+ * the aggregate bandwidth of the background flushes.
+ */
+   if( ALGO->ckpt > 0 )
+   {
+      ckst[0] = HPL_ckst.nbyte;
+      (void) HPL_all_reduce( (void *)ckst, 1, HPL_DOUBLE, HPL_sum,
+                             GRID->all_comm );
+      ckst[1] = HPL_ckst.tsnap; ckst[2] = HPL_ckst.tflush;
+      (void) HPL_all_reduce( (void *)(ckst+1), 2, HPL_DOUBLE, HPL_max,
+                             GRID->all_comm );
+      if( ( myrow == 0 ) && ( mycol == 0 ) )
+      {
+         if( HPL_ckst.jrst >= 0 )
+            HPL_fprintf( TEST->outfp,
+                         "Resumed from the checkpoint at column %d\n",
+                         HPL_ckst.jrst );
+         HPL_fprintf( TEST->outfp, "%s%6d %9.3f GB, %s %8.2f s, %s %8.2f s",
+                      "Checkpoints", HPL_ckst.nckpt, ckst[0] / 1.0e+9,
+                      "snapshot", ckst[1], "flush", ckst[2] );
+         if( ckst[2] > HPL_rzero )
+            HPL_fprintf( TEST->outfp, " (%.3f GB/s)",
+                         ckst[0] / 1.0e+9 / ckst[2] );
+         HPL_fprintf( TEST->outfp, "\n" );
+      }
+   }
+/*
+ * Combine and print the out-of-core statistics of the solve: the total
+ * volume streamed from and to the backing files,  and the time spent in
+ * applying the previous slabs and in factoring the slabs themselves.
+ */
+   if( ALGO->ooc > 0 )
+   {
+      oost[0] = HPL_oost.rbyte; oost[1] = HPL_oost.wbyte;
+      (void) HPL_all_reduce( (void *)oost, 2, HPL_DOUBLE, HPL_sum,
+                             GRID->all_comm );
+      oost[2] = HPL_oost.tleft; oost[3] = HPL_oost.tslab;
+      (void) HPL_all_reduce( (void *)(oost+2), 2, HPL_DOUBLE, HPL_max,
+                             GRID->all_comm );
+      if( ( myrow == 0 ) && ( mycol == 0 ) )
+         HPL_fprintf( TEST->outfp, "%s%6d %s %8d, %s %9.3f GB, %s %9.3f GB,"
+                      " %s %8.2f s, %s %8.2f s\n", "Slabs", HPL_oost.nslab,
+                      "width", HPL_oost.width, "read", oost[0] / 1.0e+9,
+                      "written", oost[1] / 1.0e+9, "left-looking",
+                      oost[2], "in-slab", oost[3] );
+   }
+/*
+ * Combine and print the statistics of the single precision broadcast:
+ * the total volume of panels received and saved,  and the scaled resi-
+ * dual before and after the refinement of the solution.
+ */
+   if( ( ALGO->bprec == 1 ) && ( npcol > 1 ) )
+   {
+      mxst[0] = HPL_mxst.nbyte; mxst[1] = HPL_mxst.nsave;
+      (void) HPL_all_reduce( (void *)mxst, 2, HPL_DOUBLE, HPL_sum,
+                             GRID->all_comm );
+      mxst[2] = HPL_mxst.tref;
+      (void) HPL_all_reduce( (void *)(mxst+2), 1, HPL_DOUBLE, HPL_max,
+                             GRID->all_comm );
+      if( ( myrow == 0 ) && ( mycol == 0 ) )
+      {
+         HPL_fprintf( TEST->outfp, "%s %9.3f GB, %s %9.3f GB (%.1f%%)\n",
+                      "Panels in single precision", mxst[0] / 1.0e+9,
+                      "saved", mxst[1] / 1.0e+9, ( mxst[0] > HPL_rzero ?
+                      100.0 * mxst[1] / ( mxst[0] + mxst[1] ) : HPL_rzero ) );
+         if( HPL_mxst.nstep >= 0 )
+            HPL_fprintf( TEST->outfp, "%s%3d %s %11.4e -> %11.4e, %8.2f s\n",
+                         "Refinement", HPL_mxst.nstep, "step(s), residual",
+                         HPL_mxst.rnrm0, HPL_mxst.rnrm1, mxst[2] );
+      }
+   }
 #ifdef HPL_DETAILED_TIMING
-   HPL_ptimer_combine( GRID->all_comm, HPL_AMAX_PTIME, HPL_WALL_PTIME,
-                       HPL_TIMING_N, HPL_TIMING_BEG, HPL_w );
+/*
+ * Min, max, mean and standard deviation over the processes,  and rank
+ * of the slowest one
+ */
+   HPL_ptimer_combine( GRID->all_comm, HPL_STAT_PTIME, HPL_WALL_PTIME,
+                       HPL_TIMING_N, HPL_TIMING_BEG, HPL_s );
+   for( it = 0; it < HPL_TIMING_N; it++ ) HPL_w[it] = HPL_s[HPL_TIMING_N+it];
+/*
+ * Hardware counts summed over the processes, when they are available
+ */
+   for( ii = 0; ii < HPL_NPTCTR; ii++ )
+      HPL_ptimer_combine( GRID->all_comm, HPL_SUM_PTIME,
+                          (HPL_T_PTIME)(HPL_CYC_PTIME + ii), HPL_TIMING_N,
+                          HPL_TIMING_BEG, HPL_c[ii] );
    if( ( myrow == 0 ) && ( mycol == 0 ) )
    {
       HPL_fprintf( TEST->outfp, "%s%s\n",
@@ -310,6 +467,57 @@ void HPL_pdtest
          HPL_fprintf( TEST->outfp,
                       "Max aggregated wall time up tr sv  . : %18.2f\n",
                       HPL_w[HPL_TIMING_PTRSV-HPL_TIMING_BEG] );
+/*
+ * Checkpoint snapshots
+ */
+      if( HPL_w[HPL_TIMING_CKPT-HPL_TIMING_BEG] > HPL_rzero )
+         HPL_fprintf( TEST->outfp,
+                      "Max aggregated wall time checkpoint  : %18.2f\n",
+                      HPL_w[HPL_TIMING_CKPT-HPL_TIMING_BEG] );
+/*
+ * Instructions per cycle and last level cache misses per thousand in-
+ * structions of the panel factorization and of the update:  a low IPC
+ * with a high miss rate points at a memory-bound phase.
+ */
+      for( ii = 0; ii < 2; ii++ )
+      {
+         it = ( ii == 0 ? HPL_TIMING_PFACT : HPL_TIMING_UPDATE ) -
+              HPL_TIMING_BEG;
+         if( ( HPL_c[0][it] <= HPL_rzero ) || ( HPL_c[1][it] <= HPL_rzero ) ||
+             ( HPL_c[2][it] <  HPL_rzero ) ) continue;
+         HPL_fprintf( TEST->outfp, "%s%18.2f\n", ( ii == 0 ?
+                      "Instructions per cycle pfact . . . . : " :
+                      "Instructions per cycle update  . . . : " ),
+                      HPL_c[1][it] / HPL_c[0][it] );
+         HPL_fprintf( TEST->outfp, "%s%18.2f\n", ( ii == 0 ?
+                      "LLC misses per kinstr. pfact . . . . : " :
+                      "LLC misses per kinstr. update  . . . : " ),
+                      1.0e+3 * HPL_c[2][it] / HPL_c[1][it] );
+      }
+/*
+ * Imbalance across the processes: locate the slowest process, flag it
+ * as a straggler when it delays the run by more than HPL_TIMING_SKEW of
+ * its wall time
+ */
+      HPL_fprintf( TEST->outfp, "%-10s %10s%10s%10s%10s  %s\n",
+                   "Timer", "Min", "Mean", "Max", "StdDev",
+                   "Slowest rank (P,Q)" );
+      for( it = 0; it < HPL_TIMING_N; it++ )
+      {
+         if( HPL_s[HPL_TIMING_N+it] <= HPL_rzero ) continue;
+         ir = (int)(HPL_s[4*HPL_TIMING_N+it]);
+         if( GRID->order == HPL_ROW_MAJOR )
+         { pr = ir / npcol; pc = ir - pr * npcol; }
+         else
+         { pc = ir / nprow; pr = ir - pc * nprow; }
+         HPL_fprintf( TEST->outfp,
+                      "%-10s %10.4f%10.4f%10.4f%10.4f  %4d (%d,%d)%s\n",
+                      HPL_tname[it], HPL_s[it], HPL_s[2*HPL_TIMING_N+it],
+                      HPL_s[HPL_TIMING_N+it], HPL_s[3*HPL_TIMING_N+it], ir,
+                      pr, pc, ( HPL_s[HPL_TIMING_N+it] -
+                      HPL_s[2*HPL_TIMING_N+it] > HPL_TIMING_SKEW * wtime[0] ?
+                      " straggler" : "" ) );
+      }
 
       if( TEST->thrsh <= HPL_rzero )
          HPL_fprintf( TEST->outfp, "%s%s\n",
@@ -317,11 +525,20 @@ void HPL_pdtest
                       "========================================" );
    }
 #endif
+/*
+ * Solve a batch of right-hand sides with the factors
+ */
+   HPL_pdtestk( TEST, GRID, ALGO, &mat, wtime[0] );
 /*
  * Quick return, if I am not interested in checking the computations
  */
    if( TEST->thrsh <= HPL_rzero )
-   { (TEST->kpass)++; if( vptr ) free( vptr ); return; }
+   {
+      (TEST->kpass)++;
+      HPL_pdooc_free( ALGO, vptr, lvptr ); HPL_pdooc_free( ALGO, wptr, lwptr );
+      HPL_ixmap_free( HPL_ixmap ); HPL_ixmap_free( HPL_ixmap+1 );
+      return;
+   }
 /*
  * Check info returned by solve
  */
@@ -331,66 +548,19 @@ void HPL_pdtest
          HPL_pwarn( TEST->outfp, __LINE__, "HPL_pdtest", "%s %d, %s", 
                     "Error code returned by solve is", mat.info, "skip" );
       (TEST->kskip)++;
-      if( vptr ) free( vptr ); return;
+      HPL_pdooc_free( ALGO, vptr, lvptr ); HPL_pdooc_free( ALGO, wptr, lwptr );
+      HPL_ixmap_free( HPL_ixmap ); HPL_ixmap_free( HPL_ixmap+1 );
+      return;
    }
 /*
  * Check computation, re-generate [ A | b ], compute norm 1 and inf of A and x,
- * and norm inf of b - A x. Display residual checks.
- */
-   HPL_pdmatgen( GRID, N, N+1, NB, mat.A, mat.ld, HPL_ISEED );
-   Anorm1 = HPL_pdlange( GRID, HPL_NORM_1, N, N, NB, mat.A, mat.ld );
-   AnormI = HPL_pdlange( GRID, HPL_NORM_I, N, N, NB, mat.A, mat.ld );
-/*
- * Because x is distributed in process rows, switch the norms
- */
-   XnormI = HPL_pdlange( GRID, HPL_NORM_1, 1, N, NB, mat.X, 1 );
-   Xnorm1 = HPL_pdlange( GRID, HPL_NORM_I, 1, N, NB, mat.X, 1 );
-/*
- * If I am in the col that owns b, (1) compute local BnormI, (2) all_reduce to
- * find the max (in the col). Then (3) broadcast along the rows so that every
- * process has BnormI. Note that since we use a uniform distribution in [-0.5,0.5]
- * for the entries of B, it is very likely that BnormI (<=,~) 0.5.
- */
-   Bptr = Mptr( mat.A, 0, nq, mat.ld );
-   if( mycol == HPL_indxg2p( N, NB, NB, 0, npcol ) ){
-      if( mat.mp > 0 )
-      {
-         BnormI = Bptr[HPL_idamax( mat.mp, Bptr, 1 )]; BnormI = Mabs( BnormI );
-      }
-      else
-      {
-         BnormI = HPL_rzero;
-      }
-      (void) HPL_all_reduce( (void *)(&BnormI), 1, HPL_DOUBLE, HPL_max,
-                             GRID->col_comm );
-   }
-   (void) HPL_broadcast( (void *)(&BnormI), 1, HPL_DOUBLE,
-                          HPL_indxg2p( N, NB, NB, 0, npcol ),
-                          GRID->row_comm );
-/*
- * If I own b, compute ( b - A x ) and ( - A x ) otherwise
- */
-   if( mycol == HPL_indxg2p( N, NB, NB, 0, npcol ) )
-   {
-      HPL_dgemv( HplColumnMajor, HplNoTrans, mat.mp, nq, -HPL_rone,
-                 mat.A, mat.ld, mat.X, 1, HPL_rone, Bptr, 1 );
-   }
-   else if( nq > 0 )
-   {
-      HPL_dgemv( HplColumnMajor, HplNoTrans, mat.mp, nq, -HPL_rone,
-                 mat.A, mat.ld, mat.X, 1, HPL_rzero, Bptr, 1 );
-   }
-   else { for( ii = 0; ii < mat.mp; ii++ ) Bptr[ii] = HPL_rzero; }
-/*
- * Reduce the distributed residual in process column 0
- */
-   if( mat.mp > 0 )
-      (void) HPL_reduce( Bptr, mat.mp, HPL_DOUBLE, HPL_sum, 0,
-                         GRID->row_comm );
-/*
- * Compute || b - A x ||_oo
+ * norm inf of b and of b - A x in a single pass over [ A | b ] overlapped
+ * with its generation. Display residual checks.
  */
-   resid0 = HPL_pdlange( GRID, HPL_NORM_I, N, 1, NB, Bptr, mat.ld );
+   HPL_pdregen( GRID, ALGO->nthrd, N, NB, mat.A, mat.ld, mat.X, HPL_ISEED,
+                nrm );
+   Anorm1 = nrm[0]; AnormI = nrm[1]; Xnorm1 = nrm[2]; XnormI = nrm[3];
+   BnormI = nrm[4]; resid0 = nrm[5];
 /*
  * Computes and displays norms, residuals ...
  */
@@ -431,7 +601,8 @@ void HPL_pdtest
          "||b||_oo . . . . . . . . . . . . . . . . . . . = ", BnormI );
       }
    }
-   if( vptr ) free( vptr );
+   HPL_pdooc_free( ALGO, vptr, lvptr ); HPL_pdooc_free( ALGO, wptr, lwptr );
+   HPL_ixmap_free( HPL_ixmap ); HPL_ixmap_free( HPL_ixmap+1 );
 /*
  * End of HPL_pdtest
  */
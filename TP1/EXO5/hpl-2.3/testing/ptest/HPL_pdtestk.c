@@ -0,0 +1,267 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+
+#ifdef STDC_HEADERS
+void HPL_pdtestk
+(
+   HPL_T_test *                     TEST,
+   HPL_T_grid *                     GRID,
+   HPL_T_palg *                     ALGO,
+   HPL_T_pmat *                     A,
+   const double                     TFACT
+)
+#else
+void HPL_pdtestk
+( TEST, GRID, ALGO, A, TFACT )
+   HPL_T_test *                     TEST;
+   HPL_T_grid *                     GRID;
+   HPL_T_palg *                     ALGO;
+   HPL_T_pmat *                     A;
+   const double                     TFACT;
+#endif
+{
+/*
+ * Purpose
+ * =======
+ *
+ * HPL_pdtestk solves a batch of ALGO->nrhs right-hand sides with the
+ * factors of the matrix A  returned by  HPL_pdgesv,  and  prints the
+ * time of the batch,  the time per right-hand side and the time per
+ * right-hand side when the factorization is amortized over the batch.
+ * The right-hand sides are generated by HPL_pdmatgen as an N by nrhs
+ * matrix.  When  TEST->thrsh  is positive,  A is generated again and
+ * the largest scaled residual of the batch is checked as in HPL_pdtest,
+ * the check counting as a test of its own.  A no longer contains the
+ * factors on exit in that case.
+ *
+ * Arguments
+ * =========
+ *
+ * TEST    (global input/output)         HPL_T_test *
+ *         On entry,  TEST  points  to the test data structure: outfp is
+ *         the output file stream,  thrsh  the threshold of the residual
+ *         check and epsil the relative machine precision.  On exit, the
+ *         counters kpass and kfail are updated when the check is done.
+ *
+ * GRID    (local input)                 HPL_T_grid *
+ *         On entry,  GRID  points  to the data structure containing the
+ *         process grid information.
+ *
+ * ALGO    (global input)                HPL_T_palg *
+ *         On entry,  ALGO  points to  the data structure containing the
+ *         algorithmic parameters used for the factorization.
+ *
+ * A       (local input/output)          HPL_T_pmat *
+ *         On entry, A points to the data structure containing the local
+ *         array information and the factors computed by HPL_pdgesv.
+ *
+ * TFACT   (global input)                const double
+ *         On entry, TFACT is the wall time of HPL_pdgesv.
+ *
+ * ---------------------------------------------------------------------
+ */
+/*
+ * .. Local Variables ..
+ */
+   double                     wtime[1];
+   double                     Anorm, Gflops, resid, rmax=HPL_rzero, xnorm;
+   double                     * B = NULL, * B0, * NR, * W, * XF, * XL,
+                              * work = NULL;
+   int                        K, N, NB, i, info[1], k, kl, kq, ld, mp,
+                              mycol, myrow, npcol, nprow, nq;
+/* ..
+ * .. Executable Statements ..
+ */
+   if( ( ( K = ALGO->nrhs ) <= 0 ) || ( A->n <= 0 ) ) return;
+   (void) HPL_grid_info( GRID, &nprow, &npcol, &myrow, &mycol );
+/*
+ * The factors are incomplete after a restart from a checkpoint,  and L
+ * is only accurate to single precision when broadcast as such
+ */
+   if( ( A->info != 0 ) || ( A->R == NULL ) || ( HPL_ckst.jrst >= 0 ) ||
+       ( ( ALGO->bprec == 1 ) && ( npcol > 1 ) ) )
+   {
+      if( ( myrow == 0 ) && ( mycol == 0 ) )
+         HPL_fprintf( TEST->outfp, "%s\n",
+                      "Right-hand sides skipped, the factors are not kept" );
+      return;
+   }
+
+   N  = A->n; NB = A->nb; ld = A->ld; mp = A->mp;
+   nq = HPL_numroc( N, NB, NB, mycol, 0, npcol );
+   kq = HPL_numroc( K, NB, NB, mycol, 0, npcol );
+/*
+ * B and its copy B0 are ld x kq, the solution X gathered in every pro-
+ * cess is N x K,  its local rows nq x K,  the local product with A and
+ * the residual mp x K, and the norms of the residuals and of B are 2K.
+ */
+   work = (double *)malloc( ( 2 * (size_t)(ld) * (size_t)(kq) +
+                              ( (size_t)(N) + (size_t)(nq) + (size_t)(mp) +
+                                2 ) * (size_t)(K) ) * sizeof( double ) );
+   info[0] = ( work == NULL );
+   (void) HPL_all_reduce( (void *)info, 1, HPL_INT, HPL_max,
+                          GRID->all_comm );
+   if( info[0] != 0 )
+   {
+      if( ( myrow == 0 ) && ( mycol == 0 ) )
+         HPL_pwarn( TEST->outfp, __LINE__, "HPL_pdtestk", "%s",
+                    "Memory allocation failed for the right-hand sides. "
+                    "Skip." );
+      if( work ) free( work );
+      return;
+   }
+   B  = work;         B0 = B  + (size_t)(ld) * (size_t)(kq);
+   XF = B0 + (size_t)(ld) * (size_t)(kq);
+   XL = XF + (size_t)(N)  * (size_t)(K);
+   W  = XL + (size_t)(nq) * (size_t)(K);
+   NR = W  + (size_t)(mp) * (size_t)(K);
+/*
+ * Generate and solve the batch
+ */
+   HPL_pdmatgen( GRID, N, K, NB, B, ld, HPL_ISEED + 1 );
+
+   (void) HPL_barrier( GRID->all_comm );
+   wtime[0] = HPL_timer_walltime();
+   HPL_pdgetrs( GRID, ALGO, A, kq, B );
+   wtime[0] = HPL_timer_walltime() - wtime[0];
+   (void) HPL_all_reduce( (void *)wtime, 1, HPL_DOUBLE, HPL_max,
+                          GRID->all_comm );
+/*
+ * 2 N^2 flops per right-hand side
+ */
+   if( ( myrow == 0 ) && ( mycol == 0 ) )
+   {
+      Gflops = ( wtime[0] > HPL_rzero ? 2.0e-9 * (double)(N) * (double)(N) *
+                 (double)(K) / wtime[0] : HPL_rzero );
+      HPL_fprintf( TEST->outfp, "%s%6d %s %10.4f s, %11.4e s %s, %9.3f %s\n",
+                   "HPL_pdgetrs()", K, "right-hand sides in", wtime[0],
+                   wtime[0] / (double)(K), "each", Gflops, "Gflops" );
+      HPL_fprintf( TEST->outfp, "%s%11.4e s %s\n",
+                   "Time per right-hand side with the factorization ",
+                   ( TFACT + wtime[0] ) / (double)(K), "each" );
+   }
+   if( TEST->thrsh <= HPL_rzero ) { free( work ); return; }
+/*
+ * Generate A and the batch again, and compute the scaled residuals of
+ * all the right-hand sides at once:  gather X in every process, multi-
+ * ply the local piece of A with the local rows of X,  and sum the pro-
+ * ducts in the process rows.
+ */
+   HPL_pdmatgen( GRID, N, N, NB, A->A, ld, HPL_ISEED );
+   HPL_pdmatgen( GRID, N, K, NB, B0, ld, HPL_ISEED + 1 );
+   Anorm = HPL_pdlange( GRID, HPL_NORM_I, N, N, NB, A->A, ld );
+
+   for( i = 0; i < N * K; i++ ) XF[i] = HPL_rzero;
+   for( kl = 0; kl < kq; kl++ )
+   {
+      k = HPL_indxl2g( kl, NB, NB, mycol, 0, npcol );
+      for( i = 0; i < mp; i++ )
+         XF[(size_t)(k) * (size_t)(N) +
+            (size_t)HPL_indxl2g( i, NB, NB, myrow, 0, nprow )] =
+            *Mptr( B, i, kl, ld );
+   }
+   (void) HPL_all_reduce( (void *)XF, N * K, HPL_DOUBLE, HPL_sum,
+                          GRID->all_comm );
+   for( k = 0; k < K; k++ )
+   {
+      for( i = 0; i < nq; i++ )
+         XL[(size_t)(k) * (size_t)(nq) + (size_t)(i)] =
+            XF[(size_t)(k) * (size_t)(N) +
+               (size_t)HPL_indxl2g( i, NB, NB, mycol, 0, npcol )];
+   }
+   if( ( nq > 0 ) && ( mp > 0 ) )
+      HPL_dgemm( HplColumnMajor, HplNoTrans, HplNoTrans, mp, K, nq,
+                 HPL_rone, A->A, ld, XL, nq, HPL_rzero, W, mp );
+   else { for( i = 0; i < mp * K; i++ ) W[i] = HPL_rzero; }
+   if( mp > 0 )
+      (void) HPL_all_reduce( (void *)W, mp * K, HPL_DOUBLE, HPL_sum,
+                             GRID->row_comm );
+/*
+ * The process column owning b_k computes the norms of r_k and b_k
+ */
+   for( k = 0; k < 2 * K; k++ ) NR[k] = HPL_rzero;
+   for( kl = 0; kl < kq; kl++ )
+   {
+      k = HPL_indxl2g( kl, NB, NB, mycol, 0, npcol );
+      for( i = 0; i < mp; i++ )
+      {
+         resid = *Mptr( B0, i, kl, ld ) - W[(size_t)(k) * (size_t)(mp) +
+                                            (size_t)(i)];
+         NR[k]   = Mmax( NR[k],   Mabs( resid ) );
+         NR[K+k] = Mmax( NR[K+k], Mabs( *Mptr( B0, i, kl, ld ) ) );
+      }
+   }
+   (void) HPL_all_reduce( (void *)NR, 2 * K, HPL_DOUBLE, HPL_max,
+                          GRID->all_comm );
+   for( k = 0; k < K; k++ )
+   {
+      xnorm = ( N > 0 ? XF[(size_t)(k) * (size_t)(N) +
+                           (size_t)HPL_idamax( N, XF + (size_t)(k) *
+                                               (size_t)(N), 1 )] :
+                HPL_rzero );
+      resid = NR[k] / ( TEST->epsil * ( Anorm * Mabs( xnorm ) + NR[K+k] ) *
+                        (double)(N) );
+      rmax  = Mmax( rmax, resid );
+   }
+
+   if( rmax < TEST->thrsh ) (TEST->kpass)++;
+   else                     (TEST->kfail)++;
+
+   if( ( myrow == 0 ) && ( mycol == 0 ) )
+      HPL_fprintf( TEST->outfp, "%s%16.8e%s%s\n",
+         "||AX-B||_oo/(eps*(||A||_oo*||X||_oo+||B||_oo)*N)= ", rmax,
+         " ...... ", ( rmax < TEST->thrsh ? "PASSED" : "FAILED" ) );
+
+   free( work );
+/*
+ * End of HPL_pdtestk
+ */
+}
@@ -57,7 +57,9 @@ static int         HPL_ptimer_disabled;
 static double      HPL_ptimer_cpusec   [HPL_NPTIMER],
                    HPL_ptimer_cpustart [HPL_NPTIMER],
                    HPL_ptimer_wallsec  [HPL_NPTIMER],
-                   HPL_ptimer_wallstart[HPL_NPTIMER];
+                   HPL_ptimer_wallstart[HPL_NPTIMER],
+                   HPL_ptimer_ctrsec   [HPL_NPTCTR][HPL_NPTIMER],
+                   HPL_ptimer_ctrstart [HPL_NPTCTR][HPL_NPTIMER];
 /*
  * ---------------------------------------------------------------------
  * User callable functions
@@ -70,21 +72,29 @@ void HPL_ptimer_boot()
 #endif
 {
 /*
- * HPL_ptimer_boot (re)sets all timers to 0, and enables HPL_ptimer.
+ * HPL_ptimer_boot (re)sets all timers to 0, and enables HPL_ptimer. It
+ * is called by the main thread,  that opens the hardware counters and
+ * starts the wall clock before other threads use them.
  */
 /*
  * .. Local Variables ..
  */
-   int                        i;
+   int                        i, k;
 /* ..
  * .. Executable Statements ..
  */
    HPL_ptimer_disabled = 0;
+   (void) HPL_ptimer_counter( 0 ); (void) HPL_ptimer_walltime();
 
    for( i = 0; i < HPL_NPTIMER; i++ )
    {
       HPL_ptimer_cpusec  [i] = HPL_ptimer_wallsec  [i] = HPL_rzero;
       HPL_ptimer_cpustart[i] = HPL_ptimer_wallstart[i] = HPL_PTIMER_STARTFLAG;
+      for( k = 0; k < HPL_NPTCTR; k++ )
+      {
+         HPL_ptimer_ctrsec  [k][i] = HPL_rzero;
+         HPL_ptimer_ctrstart[k][i] = HPL_PTIMER_ERROR;
+      }
    }
 /*
  * End of HPL_ptimer_boot
@@ -116,7 +126,10 @@ void HPL_ptimer( I )
  *  
  * where  I  is the timer index in  [0..64).  To  inititialize the timer
  * functionality, one must have called HPL_ptimer_boot() prior to any of
- * the functions mentioned above.
+ * the functions mentioned above.  When HPL_USE_PERF_EVENTS is defined,
+ * the hardware counters of HPL_ptimer_counter are accumulated as well
+ * for every timer,  and are retrieved in the same way with the types
+ * HPL_CYC_PTIME, HPL_INS_PTIME and HPL_LLC_PTIME.
  *
  * Arguments
  * =========
@@ -126,6 +139,13 @@ void HPL_ptimer( I )
  *
  * ---------------------------------------------------------------------
  */ 
+/*
+ * .. Local Variables ..
+ */
+#ifdef HPL_USE_PERF_EVENTS
+   double                     c;
+   int                        k;
+#endif
 /* ..
  * .. Executable Statements ..
  */
@@ -136,6 +156,10 @@ void HPL_ptimer( I )
  */
    if( HPL_ptimer_wallstart[I] == HPL_PTIMER_STARTFLAG )
    {
+#ifdef HPL_USE_PERF_EVENTS
+      for( k = 0; k < HPL_NPTCTR; k++ )
+         HPL_ptimer_ctrstart[k][I] = HPL_ptimer_counter( k );
+#endif
       HPL_ptimer_wallstart[I] = HPL_ptimer_walltime();
       HPL_ptimer_cpustart [I] = HPL_ptimer_cputime ();
    }
@@ -144,6 +168,15 @@ void HPL_ptimer( I )
       HPL_ptimer_cpusec   [I] += HPL_ptimer_cputime ()-HPL_ptimer_cpustart [I];
       HPL_ptimer_wallsec  [I] += HPL_ptimer_walltime()-HPL_ptimer_wallstart[I];
       HPL_ptimer_wallstart[I]  = HPL_PTIMER_STARTFLAG;
+#ifdef HPL_USE_PERF_EVENTS
+      for( k = 0; k < HPL_NPTCTR; k++ )
+      {
+         c = HPL_ptimer_counter( k );
+         if( ( c != HPL_PTIMER_ERROR ) &&
+             ( HPL_ptimer_ctrstart[k][I] != HPL_PTIMER_ERROR ) )
+            HPL_ptimer_ctrsec[k][I] += c - HPL_ptimer_ctrstart[k][I];
+      }
+#endif
    }
 /*
  * End of HPL_ptimer
@@ -163,6 +196,7 @@ void HPL_ptimer_enable()
  * .. Executable Statements ..
  */
    HPL_ptimer_disabled = 0;
+   (void) HPL_ptimer_counter( 0 ); (void) HPL_ptimer_walltime();
    return;
 /*
  * End of HPL_ptimer_enable
@@ -205,7 +239,7 @@ double HPL_ptimer_inquire( TMTYPE, I )
  * =======
  *
  * HPL_ptimer_inquire returns wall- or cpu- time that has accumulated in
- * timer I.
+ * timer I, or the count of a hardware event.
  *
  * Arguments
  * =========
@@ -214,7 +248,10 @@ double HPL_ptimer_inquire( TMTYPE, I )
  *         On entry, TMTYPE specifies what time will be returned as fol-
  *         lows
  *            = HPL_WALL_PTIME : wall clock time is returned,
- *            = HPL_CPU_PTIME  : CPU time is returned (default).
+ *            = HPL_CPU_PTIME  : CPU time is returned (default),
+ *            = HPL_CYC_PTIME  : CPU cycles are returned,
+ *            = HPL_INS_PTIME  : instructions retired are returned,
+ *            = HPL_LLC_PTIME  : last level cache misses are returned.
  *
  * I       (global input)              const int
  *         On entry, I specifies the timer to return.
@@ -239,6 +276,13 @@ double HPL_ptimer_inquire( TMTYPE, I )
       else
          time = HPL_ptimer_wallsec[I];
    }
+   else if( ( TMTYPE >= HPL_CYC_PTIME ) && ( TMTYPE <= HPL_LLC_PTIME ) )
+   {
+      if( HPL_ptimer_counter( TMTYPE - HPL_CYC_PTIME ) == HPL_PTIMER_ERROR )
+         time = HPL_PTIMER_ERROR;
+      else
+         time = HPL_ptimer_ctrsec[TMTYPE - HPL_CYC_PTIME][I];
+   }
    else
    {
       if( HPL_ptimer_cputime()  == HPL_PTIMER_ERROR )
@@ -252,6 +296,61 @@ double HPL_ptimer_inquire( TMTYPE, I )
  */
 }
 
+#ifdef STDC_HEADERS
+static void HPL_ptimer_stat
+(
+   MPI_Comm                   COMM,
+   const int                  N,
+   double                     * TIMES
+)
+#else
+static void HPL_ptimer_stat( COMM, N, TIMES )
+   MPI_Comm                   COMM;
+   const int                  N;
+   double                     * TIMES;
+#endif
+{
+/*
+ * Replace the local times TIMES[0:N-1] by their minimum, maximum, mean,
+ * standard deviation and the rank of the slowest process over COMM, in
+ * that order and N entries each. The sums of the times and of their
+ * squares, and the maxima of the times and of their opposites are com-
+ * bined in two reductions, the smallest rank reaching the maximum in a
+ * third one. The square root is taken by Newton iterations, HPL being
+ * linked without the C math library.
+ */
+   double                     work[4*HPL_NPTIMER], v, x, y;
+   int                        rank[HPL_NPTIMER], i, k, me, np;
+
+   (void) MPI_Comm_rank( COMM, &me ); (void) MPI_Comm_size( COMM, &np );
+   for( i = 0; i < N; i++ )
+   {
+      work[i]     = TIMES[i]; work[N+i]   = TIMES[i] * TIMES[i];
+      work[2*N+i] = TIMES[i]; work[3*N+i] = -TIMES[i];
+   }
+   (void) HPL_all_reduce( (void *)(work), 2*N, HPL_DOUBLE, HPL_sum, COMM );
+   (void) HPL_all_reduce( (void *)(work+2*N), 2*N, HPL_DOUBLE, HPL_max,
+                          COMM );
+   for( i = 0; i < N; i++ )
+      rank[i] = ( TIMES[i] == work[2*N+i] ? me : np );
+   (void) HPL_all_reduce( (void *)(rank), N, HPL_INT, HPL_min, COMM );
+
+   for( i = 0; i < N; i++ )
+   {
+      TIMES[i]     = -work[3*N+i]; TIMES[N+i]   = work[2*N+i];
+      TIMES[2*N+i] = work[i] / (double)(np);
+      v = work[N+i] / (double)(np) - TIMES[2*N+i] * TIMES[2*N+i];
+      x = HPL_rzero;
+      if( v > HPL_rzero )
+      {
+         x = ( v > HPL_rone ? v : HPL_rone );
+         for( k = 0; k < 100; k++ )
+         { y = 0.5 * ( x + v / x ); if( y >= x ) break; x = y; }
+      }
+      TIMES[3*N+i] = x; TIMES[4*N+i] = (double)(rank[i]);
+   }
+}
+
 #ifdef STDC_HEADERS
 void HPL_ptimer_combine
 (
@@ -290,13 +389,19 @@ void HPL_ptimer_combine( COMM, OPE, TMTYPE, N, IBEG, TIMES )
  *         as follows:
  *            = HPL_AMAX_PTIME get max. time on any process (default),
  *            = HPL_AMIN_PTIME get min. time on any process,
- *            = HPL_SUM_PTIME  get sum of times across processes.
+ *            = HPL_SUM_PTIME  get sum of times across processes,
+ *            = HPL_STAT_PTIME get the min., max., mean and standard de-
+ *              viation of the times  and  the  rank  in  COMM of the
+ *              slowest process,  that is the smallest rank reaching the
+ *              max.,  stored in that order,  N entries each,  in TIMES.
  *
  * TMTYPE  (global input)              const HPL_T_PTIME
  *         On entry, TMTYPE specifies what time will be returned as fol-
  *         lows
  *            = HPL_WALL_PTIME : wall clock time is returned,
- *            = HPL_CPU_PTIME  : CPU time is returned (default).
+ *            = HPL_CPU_PTIME  : CPU time is returned (default),
+ *            = HPL_CYC_PTIME, HPL_INS_PTIME or HPL_LLC_PTIME : the hard-
+ *              ware counts as in HPL_ptimer_inquire are returned.
  *
  * N       (global input)              const int
  *         On entry, N specifies the number of timers to combine.
@@ -305,19 +410,21 @@ void HPL_ptimer_combine( COMM, OPE, TMTYPE, N, IBEG, TIMES )
  *         On entry, IBEG specifies the first timer to be combined.
  *
  * TIMES   (global output)             double *
- *         On entry, TIMES is an array of dimension at least N. On exit,
- *         this array contains the requested timing information.
+ *         On entry, TIMES is an array of dimension at least N,  or 5*N
+ *         when OPE is HPL_STAT_PTIME.  On exit,  this array contains the
+ *         requested timing information.
  *
  * ---------------------------------------------------------------------
  */
 /*
  * .. Local Variables ..
  */
-   int                        i, tmpdis;
+   int                        avail[1], i, k, nt, tmpdis;
 /* ..
  * .. Executable Statements ..
  */
    tmpdis = HPL_ptimer_disabled; HPL_ptimer_disabled = 1;
+   nt = ( OPE == HPL_STAT_PTIME ? 5 * N : N );
 /*
  * Timer has been disabled for combine operation -  copy timing informa-
  * tion into user times array.  If  wall- or  cpu-time are not available
@@ -326,14 +433,31 @@ void HPL_ptimer_combine( COMM, OPE, TMTYPE, N, IBEG, TIMES )
    if( TMTYPE == HPL_WALL_PTIME )
    {
       if( HPL_ptimer_walltime() == HPL_PTIMER_ERROR )
-      { for( i = 0; i < N; i++ ) TIMES[i] = HPL_PTIMER_ERROR; return;   }
+      { for( i = 0; i < nt; i++ ) TIMES[i] = HPL_PTIMER_ERROR; return;  }
       else
       { for( i = 0; i < N; i++ ) TIMES[i] = HPL_ptimer_wallsec[IBEG+i]; }
    }
+   else if( ( TMTYPE >= HPL_CYC_PTIME ) && ( TMTYPE <= HPL_LLC_PTIME ) )
+   {
+/*
+ * The counters may be available on some processes only:  agree on it
+ * before combining
+ */
+      k = TMTYPE - HPL_CYC_PTIME;
+      avail[0] = ( HPL_ptimer_counter( k ) != HPL_PTIMER_ERROR );
+      (void) HPL_all_reduce( (void *)(avail), 1, HPL_INT, HPL_min, COMM );
+      if( avail[0] == 0 )
+      {
+         for( i = 0; i < nt; i++ ) TIMES[i] = HPL_PTIMER_ERROR;
+         HPL_ptimer_disabled = tmpdis; return;
+      }
+      else
+      { for( i = 0; i < N; i++ ) TIMES[i] = HPL_ptimer_ctrsec[k][IBEG+i]; }
+   }
    else
    {
       if( HPL_ptimer_cputime() == HPL_PTIMER_ERROR )
-      { for( i = 0; i < N; i++ ) TIMES[i] = HPL_PTIMER_ERROR; return;  }
+      { for( i = 0; i < nt; i++ ) TIMES[i] = HPL_PTIMER_ERROR; return; }
       else
       { for( i = 0; i < N; i++ ) TIMES[i] = HPL_ptimer_cpusec[IBEG+i]; }
    }
@@ -348,6 +472,8 @@ void HPL_ptimer_combine( COMM, OPE, TMTYPE, N, IBEG, TIMES )
       (void) HPL_all_reduce( (void *)(TIMES), N, HPL_DOUBLE, HPL_min, COMM );
    else if( OPE == HPL_SUM_PTIME  )
       (void) HPL_all_reduce( (void *)(TIMES), N, HPL_DOUBLE, HPL_sum, COMM );
+   else if( OPE == HPL_STAT_PTIME )
+      HPL_ptimer_stat( COMM, N, TIMES );
    else
       (void) HPL_all_reduce( (void *)(TIMES), N, HPL_DOUBLE, HPL_max, COMM );
 
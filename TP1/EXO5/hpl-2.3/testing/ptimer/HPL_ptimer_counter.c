@@ -0,0 +1,148 @@
+/* 
+ * -- High Performance Computing Linpack Benchmark (HPL)                
+ *    HPL - 2.3 - December 2, 2018                          
+ *    Antoine P. Petitet                                                
+ *    University of Tennessee, Knoxville                                
+ *    Innovative Computing Laboratory                                 
+ *    (C) Copyright 2000-2008 All Rights Reserved                       
+ *                                                                      
+ * -- Copyright notice and Licensing terms:                             
+ *                                                                      
+ * Redistribution  and  use in  source and binary forms, with or without
+ * modification, are  permitted provided  that the following  conditions
+ * are met:                                                             
+ *                                                                      
+ * 1. Redistributions  of  source  code  must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.        
+ *                                                                      
+ * 2. Redistributions in binary form must reproduce  the above copyright
+ * notice, this list of conditions,  and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution. 
+ *                                                                      
+ * 3. All  advertising  materials  mentioning  features  or  use of this
+ * software must display the following acknowledgement:                 
+ * This  product  includes  software  developed  at  the  University  of
+ * Tennessee, Knoxville, Innovative Computing Laboratory.             
+ *                                                                      
+ * 4. The name of the  University,  the name of the  Laboratory,  or the
+ * names  of  its  contributors  may  not  be used to endorse or promote
+ * products  derived   from   this  software  without  specific  written
+ * permission.                                                          
+ *                                                                      
+ * -- Disclaimer:                                                       
+ *                                                                      
+ * THIS  SOFTWARE  IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,  INCLUDING,  BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+ * OR  CONTRIBUTORS  BE  LIABLE FOR ANY  DIRECT,  INDIRECT,  INCIDENTAL,
+ * SPECIAL,  EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES  (INCLUDING,  BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA OR PROFITS; OR BUSINESS INTERRUPTION)  HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT,  STRICT LIABILITY,  OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. 
+ * ---------------------------------------------------------------------
+ */ 
+/*
+ * Include files
+ */
+#include "hpl.h"
+ 
+/* 
+ * Purpose
+ * =======
+ *
+ * HPL_ptimer_counter returns the current value of the hardware counter
+ * K of the calling process,  with K in [0..HPL_NPTCTR):  0 counts the
+ * CPU cycles,  1  the instructions retired  and  2 the misses in the
+ * last level cache.  The counters are opened once,  by the first call
+ * (under pthread_once() when HPL_USE_PTHREADS is defined),  and count
+ * in user mode the calling thread and the threads it creates after-
+ * wards:  HPL_ptimer_boot makes that first call from the main thread.
+ * If HPL_USE_PERF_EVENTS is not defined, or if a counter cannot be
+ * opened,  e.g.  because of  the  system perf_event_paranoid setting,
+ * HPL_PTIMER_ERROR is returned.
+ *
+ * ---------------------------------------------------------------------
+ */ 
+ 
+#if defined( HPL_USE_PERF_EVENTS )
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int                    HPL_ptimer_fd[HPL_NPTCTR];
+#ifdef HPL_USE_PTHREADS
+static pthread_once_t         HPL_ptimer_ctronce = PTHREAD_ONCE_INIT;
+#else
+static int                    HPL_ptimer_ctronce = 0;
+#endif
+
+#ifdef STDC_HEADERS
+static void HPL_ptimer_counter_init( void )
+#else
+static void HPL_ptimer_counter_init()
+#endif
+{
+   static const unsigned long long cfg[HPL_NPTCTR] =
+   { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+     PERF_COUNT_HW_CACHE_MISSES };
+   struct perf_event_attr     attr;
+   int                        k;
+
+   for( k = 0; k < HPL_NPTCTR; k++ )
+   {
+      (void) memset( (void *)(&attr), 0, sizeof( attr ) );
+      attr.size           = sizeof( attr );
+      attr.type           = PERF_TYPE_HARDWARE;
+      attr.config         = cfg[k];
+      attr.inherit        = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      HPL_ptimer_fd[k] = (int)syscall( __NR_perf_event_open, &attr, 0, -1,
+                                       -1, 0 );
+   }
+}
+
+#ifdef STDC_HEADERS
+double HPL_ptimer_counter( const int K )
+#else
+double HPL_ptimer_counter( K )
+   const int                  K;
+#endif
+{
+   unsigned long long         count;
+
+#ifdef HPL_USE_PTHREADS
+   (void) pthread_once( &HPL_ptimer_ctronce, HPL_ptimer_counter_init );
+#else
+   if( !HPL_ptimer_ctronce )
+   { HPL_ptimer_counter_init(); HPL_ptimer_ctronce = 1; }
+#endif
+   if( ( K < 0 ) || ( K >= HPL_NPTCTR ) || ( HPL_ptimer_fd[K] < 0 ) )
+      return( HPL_PTIMER_ERROR );
+   if( read( HPL_ptimer_fd[K], &count, sizeof( count ) ) !=
+       (ssize_t)sizeof( count ) )
+      return( HPL_PTIMER_ERROR );
+   return( (double)(count) );
+}
+ 
+#else
+
+#ifdef STDC_HEADERS
+double HPL_ptimer_counter( const int K )
+#else
+double HPL_ptimer_counter( K )
+   const int                  K;
+#endif
+{
+   (void) K;
+   return( HPL_PTIMER_ERROR );
+}
+
+#endif
+/*
+ * End of HPL_ptimer_counter
+ */
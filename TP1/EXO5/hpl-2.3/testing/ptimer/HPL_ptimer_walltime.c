@@ -53,37 +53,91 @@
  * Purpose
  * =======
  *
- * HPL_ptimer_walltime returns the elapsed (wall-clock) time.
- * 
+ * HPL_ptimer_walltime returns the elapsed (wall-clock) time.  If
+ * HPL_USE_CLOCK_GETTIME is defined,  the  POSIX  function clock_gettime()
+ * is used with the monotonic clock  not subject to frequency adjustments
+ * when available,  with a resolution  of one nanosecond  and  no system
+ * call on most platforms. If HPL_USE_GETTIMEOFDAY is defined, the func-
+ * tion gettimeofday() is used. Otherwise and by default, MPI_Wtime() is
+ * returned.  The origin of the first two clocks is taken by the first
+ * call only,  under pthread_once() when HPL_USE_PTHREADS is defined,
+ * since the threads of a process call this function concurrently.
  *
  * ---------------------------------------------------------------------
  */ 
  
-#if defined( HPL_USE_GETTIMEOFDAY )
+#if   defined( HPL_USE_CLOCK_GETTIME ) || defined( HPL_USE_GETTIMEOFDAY )
+
+#if   defined( HPL_USE_CLOCK_GETTIME )
+
+#include <time.h>
+
+#ifdef CLOCK_MONOTONIC_RAW
+#define    HPL_PTIMER_CLOCK      CLOCK_MONOTONIC_RAW
+#else
+#define    HPL_PTIMER_CLOCK      CLOCK_MONOTONIC
+#endif
+
+static struct timespec        HPL_ptimer_start;
+
+#else
  
 #include <sys/time.h>
 #include <sys/resource.h>
 
+static struct timeval         HPL_ptimer_start;
+
+#endif
+
+#ifdef HPL_USE_PTHREADS
+static pthread_once_t         HPL_ptimer_once = PTHREAD_ONCE_INIT;
+#else
+static int                    HPL_ptimer_once = 0;
+#endif
+
+#ifdef STDC_HEADERS
+static void HPL_ptimer_walltime_init( void )
+#else
+static void HPL_ptimer_walltime_init()
+#endif
+{
+#if   defined( HPL_USE_CLOCK_GETTIME )
+   (void) clock_gettime( HPL_PTIMER_CLOCK, &HPL_ptimer_start );
+#else
+   (void) gettimeofday( &HPL_ptimer_start, NULL );
+#endif
+}
+
 #ifdef STDC_HEADERS
 double HPL_ptimer_walltime( void )
 #else
 double HPL_ptimer_walltime()
 #endif
 {
+#if   defined( HPL_USE_CLOCK_GETTIME )
+   struct timespec            tp;
+#else
    struct timeval             tp;
-   static long                start=0, startu;
- 
-   if( !start )
-   {
-      (void) gettimeofday( &tp, NULL );
-      start  = tp.tv_sec;
-      startu = tp.tv_usec;
-      return( HPL_rzero );
-   }
+#endif
+
+#ifdef HPL_USE_PTHREADS
+   (void) pthread_once( &HPL_ptimer_once, HPL_ptimer_walltime_init );
+#else
+   if( !HPL_ptimer_once ) { HPL_ptimer_walltime_init(); HPL_ptimer_once = 1; }
+#endif
+#if   defined( HPL_USE_CLOCK_GETTIME )
+   (void) clock_gettime( HPL_PTIMER_CLOCK, &tp );
+
+   return( (double)( tp.tv_sec - HPL_ptimer_start.tv_sec ) +
+           ( (double)( tp.tv_nsec - HPL_ptimer_start.tv_nsec ) /
+             1000000000.0 ) );
+#else
    (void) gettimeofday( &tp, NULL );
  
-   return( (double)( tp.tv_sec - start ) +
-           ( (double)( tp.tv_usec-startu ) / 1000000.0 ) );
+   return( (double)( tp.tv_sec - HPL_ptimer_start.tv_sec ) +
+           ( (double)( tp.tv_usec - HPL_ptimer_start.tv_usec ) /
+             1000000.0 ) );
+#endif
 }
 
 #else
@@ -53,36 +53,87 @@
  * Purpose
  * =======
  *
- * HPL_timer_walltime returns the elapsed (wall-clock) time.
- * 
+ * HPL_timer_walltime returns the elapsed (wall-clock) time.  If
+ * HPL_USE_CLOCK_GETTIME  is defined,  the  POSIX function clock_gettime()
+ * is used with the monotonic clock,  and gettimeofday() otherwise.  The
+ * origin of the time is taken by the first call only,  under pthread_-
+ * once() when HPL_USE_PTHREADS is defined, since the threads of a pro-
+ * cess call this function concurrently.
  *
  * ---------------------------------------------------------------------
  */ 
 
+#if defined( HPL_USE_CLOCK_GETTIME )
+
+#include <time.h>
+
+#ifdef CLOCK_MONOTONIC_RAW
+#define    HPL_TIMER_CLOCK       CLOCK_MONOTONIC_RAW
+#else
+#define    HPL_TIMER_CLOCK       CLOCK_MONOTONIC
+#endif
+
+static struct timespec        HPL_timer_start;
+
+#else
+
 #include <sys/time.h>
 #include <sys/resource.h>
 
+static struct timeval         HPL_timer_start;
+
+#endif
+
+#ifdef HPL_USE_PTHREADS
+static pthread_once_t         HPL_timer_once = PTHREAD_ONCE_INIT;
+#else
+static int                    HPL_timer_once = 0;
+#endif
+
+#ifdef STDC_HEADERS
+static void HPL_timer_walltime_init( void )
+#else
+static void HPL_timer_walltime_init()
+#endif
+{
+#if defined( HPL_USE_CLOCK_GETTIME )
+   (void) clock_gettime( HPL_TIMER_CLOCK, &HPL_timer_start );
+#else
+   (void) gettimeofday( &HPL_timer_start, NULL );
+#endif
+}
+
 #ifdef STDC_HEADERS
 double HPL_timer_walltime( void )
 #else
 double HPL_timer_walltime()
 #endif
 {
+#if defined( HPL_USE_CLOCK_GETTIME )
+   struct timespec            tp;
+#else
    struct timeval             tp;
-   static long                start=0, startu;
+#endif
 
-   if( !start )
-   {
-      (void) gettimeofday( &tp, NULL );
-      start  = tp.tv_sec;
-      startu = tp.tv_usec;
-      return( HPL_rzero );
-   }
+#ifdef HPL_USE_PTHREADS
+   (void) pthread_once( &HPL_timer_once, HPL_timer_walltime_init );
+#else
+   if( !HPL_timer_once ) { HPL_timer_walltime_init(); HPL_timer_once = 1; }
+#endif
+#if defined( HPL_USE_CLOCK_GETTIME )
+   (void) clock_gettime( HPL_TIMER_CLOCK, &tp );
+
+   return( (double)( tp.tv_sec - HPL_timer_start.tv_sec ) +
+           ( (double)( tp.tv_nsec - HPL_timer_start.tv_nsec ) /
+             1000000000.0 ) );
+#else
    (void) gettimeofday( &tp, NULL );
 
-   return( (double)( tp.tv_sec - start ) +
-           ( (double)( tp.tv_usec-startu ) / 1000000.0 ) );
-}                                                                               
+   return( (double)( tp.tv_sec - HPL_timer_start.tv_sec ) +
+           ( (double)( tp.tv_usec - HPL_timer_start.tv_usec ) /
+             1000000.0 ) );
+#endif
+}
 /*
  * End of HPL_timer_walltime
  */